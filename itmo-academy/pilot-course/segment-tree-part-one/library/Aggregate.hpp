@@ -0,0 +1,330 @@
+#pragma once
+
+#include <type_traits>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "RangeEngine.hpp"
+#include "Algebra.hpp"
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    constexpr Int SumField{1};
+    constexpr Int MinimumField{2};
+    constexpr Int MaximumField{4};
+    constexpr Int CountField{8};
+    constexpr Int AllFields{SumField | MinimumField | MaximumField | CountField};
+
+    template <Int Field, typename T, bool Enabled>
+    struct Slot
+    {
+        Slot(const T &value) noexcept : value{value} {}
+
+        T value;
+    };
+
+    template <Int Field, typename T>
+    struct Slot<Field, T, false>
+    {
+        Slot(const T &) noexcept {}
+    };
+
+    template <Int Fields, Int Field, typename T>
+    using FieldSlot = Slot<Field, T, (Fields & Field) != 0>;
+
+    template <typename T, Int Fields = AllFields>
+    class Aggregate : private FieldSlot<Fields, SumField, T>, private FieldSlot<Fields, MinimumField, T>,
+        private FieldSlot<Fields, MaximumField, T>, private FieldSlot<Fields, CountField, Int>
+    {
+        static_assert(std::is_arithmetic<T>::value);
+        static_assert((Fields & CountField) == 0 || (Fields & MinimumField) != 0);
+
+        using SumSlot = FieldSlot<Fields, SumField, T>;
+        using MinimumSlot = FieldSlot<Fields, MinimumField, T>;
+        using MaximumSlot = FieldSlot<Fields, MaximumField, T>;
+        using CountSlot = FieldSlot<Fields, CountField, Int>;
+
+        template <typename, Int>
+        friend class Aggregate;
+
+    public:
+        static constexpr bool Commutative{true};
+        static constexpr bool Idempotent{false};
+        static constexpr bool Invertible{Fields == SumField};
+
+    public:
+        struct Columns
+        {
+            std::vector<T> sums{};
+            std::vector<T> minima{};
+            std::vector<T> maxima{};
+            std::vector<Int> counts{};
+
+            void Resize(const Int &size)
+            {
+                Aggregate identity{};
+                if constexpr (Has(SumField))
+                {
+                    sums.assign(size, identity.SumSlot::value);
+                }
+                if constexpr (Has(MinimumField))
+                {
+                    minima.assign(size, identity.MinimumSlot::value);
+                }
+                if constexpr (Has(MaximumField))
+                {
+                    maxima.assign(size, identity.MaximumSlot::value);
+                }
+                if constexpr (Has(CountField))
+                {
+                    counts.assign(size, identity.CountSlot::value);
+                }
+            }
+
+            Aggregate Load(const Int &i) const noexcept
+            {
+                Aggregate aggregate{};
+                if constexpr (Has(SumField))
+                {
+                    aggregate.SumSlot::value = sums[i];
+                }
+                if constexpr (Has(MinimumField))
+                {
+                    aggregate.MinimumSlot::value = minima[i];
+                }
+                if constexpr (Has(MaximumField))
+                {
+                    aggregate.MaximumSlot::value = maxima[i];
+                }
+                if constexpr (Has(CountField))
+                {
+                    aggregate.CountSlot::value = counts[i];
+                }
+                return aggregate;
+            }
+
+            void Store(const Int &i, const Aggregate &aggregate) noexcept
+            {
+                if constexpr (Has(SumField))
+                {
+                    sums[i] = aggregate.SumSlot::value;
+                }
+                if constexpr (Has(MinimumField))
+                {
+                    minima[i] = aggregate.MinimumSlot::value;
+                }
+                if constexpr (Has(MaximumField))
+                {
+                    maxima[i] = aggregate.MaximumSlot::value;
+                }
+                if constexpr (Has(CountField))
+                {
+                    counts[i] = aggregate.CountSlot::value;
+                }
+            }
+
+            void Combine(const Int &a, const Int &b) noexcept
+            {
+                auto sum{sums.data()};
+                auto minimum{minima.data()};
+                auto maximum{maxima.data()};
+                auto count{counts.data()};
+#pragma GCC ivdep
+                for (auto p{a}; p < b; ++p)
+                {
+                    if constexpr (Has(SumField))
+                    {
+                        sum[p] = sum[2 * p] + sum[2 * p + 1];
+                    }
+                    if constexpr (Has(MinimumField))
+                    {
+                        auto x{minimum[2 * p]}, y{minimum[2 * p + 1]};
+                        auto m{std::min(x, y)};
+                        if constexpr (Has(CountField))
+                        {
+                            count[p] = (x == m) * count[2 * p] + (y == m) * count[2 * p + 1];
+                        }
+                        minimum[p] = m;
+                    }
+                    if constexpr (Has(MaximumField))
+                    {
+                        maximum[p] = std::max(maximum[2 * p], maximum[2 * p + 1]);
+                    }
+                }
+            }
+
+            Long Bytes() const noexcept
+            {
+                return AllocatedBytes(sums.capacity() * sizeof(T))
+                    + AllocatedBytes(minima.capacity() * sizeof(T))
+                    + AllocatedBytes(maxima.capacity() * sizeof(T))
+                    + AllocatedBytes(counts.capacity() * sizeof(Int));
+            }
+        };
+
+    public:
+        Aggregate(const T &value, const Int &count = 1) noexcept
+            : SumSlot{static_cast<T>(value * count)}, MinimumSlot{value}, MaximumSlot{value}, CountSlot{count} {}
+
+        Aggregate() noexcept
+            : SumSlot{T{}}, MinimumSlot{std::numeric_limits<T>::max()},
+              MaximumSlot{std::numeric_limits<T>::lowest()}, CountSlot{0} {}
+
+        template <Int Superset>
+        Aggregate(const Aggregate<T, Superset> &other) noexcept : Aggregate{}
+        {
+            static_assert((Fields & ~Superset) == 0);
+            if constexpr (Has(SumField))
+            {
+                SumSlot::value = other.SumSlot::value;
+            }
+            if constexpr (Has(MinimumField))
+            {
+                MinimumSlot::value = other.MinimumSlot::value;
+            }
+            if constexpr (Has(MaximumField))
+            {
+                MaximumSlot::value = other.MaximumSlot::value;
+            }
+            if constexpr (Has(CountField))
+            {
+                CountSlot::value = other.CountSlot::value;
+            }
+        }
+
+        Aggregate operator+(const Aggregate &other) const noexcept
+        {
+            Aggregate result{};
+            if constexpr (Has(SumField))
+            {
+                result.SumSlot::value = SumSlot::value + other.SumSlot::value;
+            }
+            if constexpr (Has(MinimumField))
+            {
+                auto x{MinimumSlot::value}, y{other.MinimumSlot::value};
+                auto m{std::min(x, y)};
+                if constexpr (Has(CountField))
+                {
+                    result.CountSlot::value = (x == m) * CountSlot::value + (y == m) * other.CountSlot::value;
+                }
+                result.MinimumSlot::value = m;
+            }
+            if constexpr (Has(MaximumField))
+            {
+                result.MaximumSlot::value = std::max(MaximumSlot::value, other.MaximumSlot::value);
+            }
+            return result;
+        }
+
+        Aggregate operator-(const Aggregate &other) const noexcept
+        {
+            static_assert(Invertible);
+            Aggregate result{};
+            result.SumSlot::value = SumSlot::value - other.SumSlot::value;
+            return result;
+        }
+
+        static constexpr bool Has(const Int &field) noexcept
+        {
+            return (Fields & field) != 0;
+        }
+
+        const T &Sum() const noexcept
+        {
+            static_assert(Has(SumField));
+            return SumSlot::value;
+        }
+
+        const T &Minimum() const noexcept
+        {
+            static_assert(Has(MinimumField));
+            return MinimumSlot::value;
+        }
+
+        const T &Maximum() const noexcept
+        {
+            static_assert(Has(MaximumField));
+            return MaximumSlot::value;
+        }
+
+        const Int &Count() const noexcept
+        {
+            static_assert(Has(CountField));
+            return CountSlot::value;
+        }
+    };
+
+    template <typename T, Int Fields>
+    std::ostream &operator<<(std::ostream &output, const Aggregate<T, Fields> &aggregate)
+    {
+        auto separator{""};
+        if constexpr (Aggregate<T, Fields>::Has(SumField))
+        {
+            output << separator << aggregate.Sum(), separator = " ";
+        }
+        if constexpr (Aggregate<T, Fields>::Has(MinimumField))
+        {
+            output << separator << aggregate.Minimum(), separator = " ";
+        }
+        if constexpr (Aggregate<T, Fields>::Has(MaximumField))
+        {
+            output << separator << aggregate.Maximum(), separator = " ";
+        }
+        if constexpr (Aggregate<T, Fields>::Has(CountField))
+        {
+            output << separator << aggregate.Count();
+        }
+        return output;
+    }
+
+    template <typename T, Int Fields = AllFields,
+        typename Tree = RangeEngine<Aggregate<T, Fields>, Algebra::Sum<Aggregate<T, Fields>>>>
+    class RangeAggregate
+    {
+    public:
+        static constexpr const char *Name{Tree::Name};
+        static constexpr Int NPos{std::numeric_limits<Int>::max()};
+
+    public:
+        RangeAggregate(const Int &l, const Int &r) noexcept : tree{l, r}, l{l} {}
+
+        void Update(const Int &i, const T &u) noexcept
+        {
+            tree.Update(i, u);
+        }
+
+        template <Int Subset = Fields>
+        Aggregate<T, Subset> Query(const Int &l, const Int &r) const noexcept
+        {
+            return tree.Query(l, r);
+        }
+
+        Int FirstAtLeast(const T &x) const noexcept
+        {
+            return tree.MaxRight(l, [&x](const Aggregate<T, Fields> &aggregate)
+            {
+                return aggregate.Maximum() < x;
+            });
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            tree.Build(initial);
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            return tree.MemoryUsage();
+        }
+
+    private:
+        Tree tree;
+        Int l{};
+    };
+
+}; // namespace DataStructures
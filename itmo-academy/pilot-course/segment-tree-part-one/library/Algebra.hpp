@@ -0,0 +1,84 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Types.hpp"
+
+namespace Algebra
+{
+
+    template <typename T, typename = void>
+    struct Traits
+    {
+        static constexpr bool Commutative{std::is_arithmetic<T>::value};
+        static constexpr bool Idempotent{false};
+        static constexpr bool Invertible{std::is_arithmetic<T>::value};
+    };
+
+    template <typename T>
+    struct Traits<T, std::void_t<decltype(T::Commutative)>>
+    {
+        static constexpr bool Commutative{T::Commutative};
+        static constexpr bool Idempotent{T::Idempotent};
+        static constexpr bool Invertible{T::Invertible};
+    };
+
+    template <typename T>
+    struct Sum
+    {
+        static constexpr bool Commutative{Traits<T>::Commutative};
+        static constexpr bool Idempotent{Traits<T>::Idempotent};
+        static constexpr bool Invertible{Traits<T>::Invertible};
+
+        static T Identity() noexcept
+        {
+            return T{};
+        }
+
+        static T Combine(const T &a, const T &b) noexcept
+        {
+            return a + b;
+        }
+
+        static void Accumulate(T &accumulator, const T &x) noexcept
+        {
+            accumulator = accumulator + x;
+        }
+
+        static T Inverse(const T &a, const T &b) noexcept
+        {
+            return a - b;
+        }
+    };
+
+    template <typename T>
+    struct Product
+    {
+        static constexpr bool Commutative{Traits<T>::Commutative};
+        static constexpr bool Idempotent{false};
+        static constexpr bool Invertible{false};
+
+        static T Identity() noexcept
+        {
+            if constexpr (std::is_arithmetic<T>::value)
+            {
+                return T{1};
+            }
+            else
+            {
+                return T::Identity();
+            }
+        }
+
+        static T Combine(const T &a, const T &b) noexcept
+        {
+            return a * b;
+        }
+
+        static void Accumulate(T &accumulator, const T &x) noexcept
+        {
+            accumulator *= x;
+        }
+    };
+
+}; // namespace Algebra
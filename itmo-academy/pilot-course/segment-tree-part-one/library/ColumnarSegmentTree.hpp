@@ -0,0 +1,122 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename = void>
+    struct Columnar : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct Columnar<T, std::void_t<typename T::Columns>> : std::true_type
+    {
+    };
+
+    template <typename T, typename Monoid>
+    class ColumnarSegmentTree
+    {
+        static_assert(Columnar<T>::value);
+
+    public:
+        static constexpr const char *Name{"ColumnarSegmentTree"};
+
+    public:
+        ColumnarSegmentTree(const Int &l, const Int &r) noexcept : n{r - l + 1}, size{Leaves(n)}, l{l}
+        {
+            columns.Resize(2 * size);
+        }
+
+        void Update(const Int &i, const T &u) noexcept
+        {
+            auto p{i - l + size};
+            for (columns.Store(p, u); p > 1; p >>= 1)
+            {
+                columns.Combine(p >> 1, (p >> 1) + 1);
+            }
+        }
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            auto a{l - this->l + size}, b{r - this->l + size + 1};
+            auto suffix{Monoid::Identity()};
+            for (; a < b; a >>= 1, b >>= 1)
+            {
+                if (a & 1)
+                {
+                    Monoid::Accumulate(accumulator, columns.Load(a++));
+                }
+                if (b & 1)
+                {
+                    suffix = Monoid::Combine(columns.Load(--b), suffix);
+                }
+            }
+            Monoid::Accumulate(accumulator, suffix);
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            auto result{Monoid::Identity()};
+            QueryInto(l, r, result);
+            return result;
+        }
+
+        T Root() const noexcept
+        {
+            return columns.Load(1);
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                columns.Store(size + i, initial[i]);
+            }
+            for (auto i{n}; i < size; ++i)
+            {
+                columns.Store(size + i, Monoid::Identity());
+            }
+            for (auto b{size}; b > 1;)
+            {
+                auto a{(b + 1) / 2};
+                columns.Combine(a, b);
+                b = a;
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = 2 * size;
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = sizeof(T);
+            usage.totalBytes = columns.Bytes();
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static Int Leaves(const Int &n) noexcept
+        {
+            if constexpr (Monoid::Commutative)
+            {
+                return n;
+            }
+            Int size{1};
+            for (; size < n; size <<= 1);
+            return size;
+        }
+
+    private:
+        typename T::Columns columns{};
+        Int n{};
+        Int size{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <thread>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    class CoordinateCompression
+    {
+    public:
+        static constexpr const char *Name{"CoordinateCompression"};
+
+    public:
+        const Int &Rank(const Int &i) const noexcept
+        {
+            return ranks[i];
+        }
+
+        const Long &Key(const Int &rank) const noexcept
+        {
+            return keys[rank];
+        }
+
+        const std::vector<Int> &Ranks() const noexcept
+        {
+            return ranks;
+        }
+
+        const std::vector<Long> &Keys() const noexcept
+        {
+            return keys;
+        }
+
+        Int Size() const noexcept
+        {
+            return keys.size();
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial)
+        {
+            Int n(initial.size());
+            Int workers{std::max(1u, std::thread::hardware_concurrency())};
+            workers = std::max(1u, std::min(workers, n / ParallelThreshold));
+            Int chunk{(n + workers - 1) / workers};
+            std::vector<Entry> sorted(n), scratch(n);
+            Parallel(workers, [&](const Int &w)
+            {
+                for (auto i{w * chunk}, end{std::min(n, i + chunk)}; i < end; ++i)
+                {
+                    sorted[i] = {static_cast<Word>(initial[i]) ^ SignBit, i};
+                }
+            });
+            for (Int shift = 0; shift < 8 * sizeof(Word); shift += RadixBits)
+            {
+                if (Scatter(sorted, scratch, shift, workers))
+                {
+                    sorted.swap(scratch);
+                }
+            }
+            scratch = {};
+            std::vector<Int> starts(workers + 1);
+            Parallel(workers, [&](const Int &w)
+            {
+                for (auto k{std::max(1u, w * chunk)}, end{std::min(n, w * chunk + chunk)}; k < end; ++k)
+                {
+                    starts[w + 1] += sorted[k - 1].first != sorted[k].first;
+                }
+            });
+            for (Int w = 0; w < workers; ++w)
+            {
+                starts[w + 1] += starts[w];
+            }
+            ranks.assign(n, 0);
+            keys.assign(n > 0 ? starts[workers] + 1 : 0, 0);
+            Parallel(workers, [&](const Int &w)
+            {
+                auto rank{starts[w]};
+                for (auto k{w * chunk}, end{std::min(n, k + chunk)}; k < end; ++k)
+                {
+                    if (k == 0 || sorted[k - 1].first != sorted[k].first)
+                    {
+                        rank += k > 0;
+                        keys[rank] = static_cast<Long>(sorted[k].first ^ SignBit);
+                    }
+                    ranks[sorted[k].second] = rank;
+                }
+            });
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = keys.size();
+            usage.valueBytes = sizeof(Long);
+            usage.nodeBytes = sizeof(Long);
+            usage.totalBytes = AllocatedBytes(keys.capacity() * sizeof(Long));
+            usage.totalBytes += AllocatedBytes(ranks.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        using Word = unsigned long long int;
+        using Entry = std::pair<Word, Int>;
+
+        static constexpr Word SignBit{Word{1} << (8 * sizeof(Word) - 1)};
+        static constexpr Int ParallelThreshold{1 << 16};
+        static constexpr Int RadixBits{11};
+        static constexpr Int Buckets{1 << RadixBits};
+
+        template <typename Task>
+        static void Parallel(const Int &workers, const Task &task)
+        {
+            std::vector<std::thread> pool{};
+            for (Int w = 1; w < workers; ++w)
+            {
+                pool.emplace_back(task, w);
+            }
+            task(0);
+            for (auto &worker : pool)
+            {
+                worker.join();
+            }
+        }
+
+        static bool Scatter(const std::vector<Entry> &from, std::vector<Entry> &to,
+            const Int &shift, const Int &workers)
+        {
+            Int n(from.size()), chunk{(n + workers - 1) / workers};
+            std::vector<Int> offsets(workers * Buckets);
+            Parallel(workers, [&](const Int &w)
+            {
+                auto *count{offsets.data() + w * Buckets};
+                for (auto i{w * chunk}, end{std::min(n, i + chunk)}; i < end; ++i)
+                {
+                    ++count[from[i].first >> shift & (Buckets - 1)];
+                }
+            });
+            for (Int digit = 0, offset = 0; digit < Buckets; ++digit)
+            {
+                Int total{};
+                for (Int w = 0; w < workers; ++w)
+                {
+                    auto count{offsets[w * Buckets + digit]};
+                    offsets[w * Buckets + digit] = offset + total;
+                    total += count;
+                }
+                if (total == n)
+                {
+                    return false;
+                }
+                offset += total;
+            }
+            Parallel(workers, [&](const Int &w)
+            {
+                Int offset[Buckets];
+                std::copy_n(offsets.data() + w * Buckets, Buckets, offset);
+                for (auto i{w * chunk}, end{std::min(n, i + chunk)}; i < end; ++i)
+                {
+                    to[offset[from[i].first >> shift & (Buckets - 1)]++] = from[i];
+                }
+            });
+            return true;
+        }
+
+    private:
+        std::vector<Long> keys{};
+        std::vector<Int> ranks{};
+    };
+
+}; // namespace DataStructures
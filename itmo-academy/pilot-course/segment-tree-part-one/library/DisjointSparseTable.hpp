@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid>
+    class DisjointSparseTable
+    {
+    public:
+        static constexpr const char *Name{"DisjointSparseTable"};
+
+    public:
+        DisjointSparseTable(const Int &l, const Int &r) noexcept : n{r - l + 1}, l{l}
+        {
+            for (size = 1, levels = 1; size < n; size <<= 1, ++levels);
+            table.assign(static_cast<std::size_t>(levels) * size, Monoid::Identity());
+        }
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l};
+            if (a == b)
+            {
+                Monoid::Accumulate(accumulator, table[a]);
+                return;
+            }
+            auto level{Level(a ^ b)};
+            Monoid::Accumulate(accumulator, level[a]);
+            Monoid::Accumulate(accumulator, level[b]);
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l};
+            if (a == b)
+            {
+                return table[a];
+            }
+            auto level{Level(a ^ b)};
+            return Monoid::Combine(level[a], level[b]);
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial)
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                table[i] = initial[i];
+            }
+            Int workers{std::min(levels - 1, std::thread::hardware_concurrency())};
+            if (size < ParallelThreshold || workers < 2)
+            {
+                for (Int h = 1; h < levels; ++h)
+                {
+                    BuildLevel(h);
+                }
+                return;
+            }
+            std::vector<std::thread> threads{};
+            for (Int w = 0; w < workers; ++w)
+            {
+                threads.emplace_back([this, w, workers]
+                {
+                    for (auto h{w + 1}; h < levels; h += workers)
+                    {
+                        BuildLevel(h);
+                    }
+                });
+            }
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = table.size();
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = sizeof(T);
+            usage.totalBytes = AllocatedBytes(table.capacity() * sizeof(T));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static constexpr Int ParallelThreshold{1 << 16};
+
+        const T *Level(const Int &difference) const noexcept
+        {
+            Int h{32u - __builtin_clz(difference)};
+            return table.data() + static_cast<std::size_t>(h) * size;
+        }
+
+        void BuildLevel(const Int &h) noexcept
+        {
+            auto *level{table.data() + static_cast<std::size_t>(h) * size};
+            Int half{1u << (h - 1)};
+            for (Int start = 0; start + half < n; start += 2 * half)
+            {
+                auto middle{start + half};
+                level[middle - 1] = table[middle - 1];
+                for (auto i{middle - 1}; i-- > start;)
+                {
+                    level[i] = Monoid::Combine(table[i], level[i + 1]);
+                }
+                auto end{std::min(middle + half, n)};
+                level[middle] = table[middle];
+                for (auto i{middle + 1}; i < end; ++i)
+                {
+                    level[i] = Monoid::Combine(level[i - 1], table[i]);
+                }
+            }
+        }
+
+    private:
+        std::vector<T> table{};
+        Int levels{};
+        Int size{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid>
+    class FenwickTree
+    {
+        static_assert(Monoid::Invertible && Monoid::Commutative);
+
+    public:
+        static constexpr const char *Name{"FenwickTree"};
+
+    public:
+        FenwickTree(const Int &l, const Int &r) noexcept
+            : values(r - l + 1, Monoid::Identity()), tree(r - l + 2, Monoid::Identity()), l{l} {}
+
+        void Update(const Int &i, const T &u) noexcept
+        {
+            auto delta{Monoid::Inverse(u, values[i - l])};
+            values[i - l] = u;
+            for (auto k{i - l + 1}; k < tree.size(); k += k & -k)
+            {
+                tree[k] = Monoid::Combine(tree[k], delta);
+            }
+        }
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            Monoid::Accumulate(accumulator, Query(l, r));
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            return Monoid::Inverse(Prefix(r - this->l + 1), Prefix(l - this->l));
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int k = 1; k < tree.size(); ++k)
+            {
+                tree[k] = values[k - 1] = initial[k - 1];
+            }
+            for (Int k = 1; k < tree.size(); ++k)
+            {
+                auto parent{k + (k & -k)};
+                if (parent < tree.size())
+                {
+                    tree[parent] = Monoid::Combine(tree[parent], tree[k]);
+                }
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = values.size();
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = 2 * sizeof(T);
+            usage.totalBytes = AllocatedBytes(values.capacity() * sizeof(T))
+                + AllocatedBytes(tree.capacity() * sizeof(T));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        T Prefix(Int k) const noexcept
+        {
+            auto result{Monoid::Identity()};
+            for (; k > 0; k &= k - 1)
+            {
+                result = Monoid::Combine(result, tree[k]);
+            }
+            return result;
+        }
+
+    private:
+        std::vector<T> values{};
+        std::vector<T> tree{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
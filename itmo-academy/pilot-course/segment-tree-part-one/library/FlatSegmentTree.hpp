@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid>
+    class FlatSegmentTree
+    {
+        static_assert(Monoid::Commutative);
+
+    public:
+        static constexpr const char *Name{"FlatSegmentTree"};
+
+    public:
+        FlatSegmentTree(const Int &l, const Int &r) noexcept
+            : tree(2 * (r - l + 1), Monoid::Identity()), n{r - l + 1}, l{l} {}
+
+        void Update(const Int &i, const T &u) noexcept
+        {
+            auto p{i - l + n};
+            for (tree[p] = u; p > 1; p >>= 1)
+            {
+                tree[p >> 1] = Monoid::Combine(tree[p], tree[p ^ 1]);
+            }
+        }
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            auto a{l - this->l + n}, b{r - this->l + n + 1};
+            for (; a < b; a >>= 1, b >>= 1)
+            {
+                if (a & 1)
+                {
+                    Monoid::Accumulate(accumulator, tree[a++]);
+                }
+                if (b & 1)
+                {
+                    Monoid::Accumulate(accumulator, tree[--b]);
+                }
+            }
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            auto result{Monoid::Identity()};
+            QueryInto(l, r, result);
+            return result;
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                tree[n + i] = initial[i];
+            }
+            for (auto p{n - 1}; p > 0; --p)
+            {
+                tree[p] = Monoid::Combine(tree[2 * p], tree[2 * p + 1]);
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = tree.size();
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = sizeof(T);
+            usage.totalBytes = AllocatedBytes(tree.capacity() * sizeof(T));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        std::vector<T> tree{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    class IntervalRelations
+    {
+    public:
+        static constexpr const char *Name{"IntervalRelations"};
+        static constexpr Int NPos{std::numeric_limits<Int>::max()};
+
+    public:
+        IntervalRelations(const Int &l, const Int &r) noexcept
+            : intersecting((r - l + 1) / 2), nested((r - l + 1) / 2) {}
+
+        const Int &Nested(const Int &k) const noexcept
+        {
+            return nested[k];
+        }
+
+        const Int &Intersecting(const Int &k) const noexcept
+        {
+            return intersecting[k];
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &endpoints)
+        {
+            Int n(2 * nested.size());
+            std::vector<Int> first(nested.size(), NPos), tree(n + 1);
+            for (Int i = 0; i < n; ++i)
+            {
+                const auto &k{endpoints[i]};
+                if (first[k] == NPos)
+                {
+                    first[k] = i;
+                    continue;
+                }
+                const auto &j{first[k]};
+                Int closed{};
+                for (auto p{i}; p > 0; p &= p - 1)
+                {
+                    closed += tree[p];
+                }
+                for (auto p{j + 1}; p > 0; p &= p - 1)
+                {
+                    closed -= tree[p];
+                }
+                nested[k] = closed;
+                intersecting[k] = i - j - 1 - 2 * closed;
+                for (auto p{j + 1}; p <= n; p += p & -p)
+                {
+                    ++tree[p];
+                }
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = nested.size();
+            usage.valueBytes = 2 * sizeof(Int);
+            usage.nodeBytes = 2 * sizeof(Int);
+            usage.totalBytes = AllocatedBytes(nested.capacity() * sizeof(Int));
+            usage.totalBytes += AllocatedBytes(intersecting.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        std::vector<Int> intersecting{};
+        std::vector<Int> nested{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <type_traits>
+#include <algorithm>
+#include <limits>
+
+#include "Types.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T>
+    class Maximum
+    {
+        static_assert(std::is_integral<T>::value);
+
+    public:
+        static constexpr bool Commutative{true};
+        static constexpr bool Idempotent{true};
+        static constexpr bool Invertible{false};
+
+    public:
+        Maximum(const T &value) noexcept : value{value} {}
+
+        Maximum() = default;
+
+        Maximum operator+(const Maximum &other) const noexcept
+        {
+            return {std::max(value, other.value)};
+        }
+
+        operator const T &() const noexcept
+        {
+            return value;
+        }
+
+    private:
+        static constexpr T Neutral{std::numeric_limits<T>::min()};
+
+        T value{Neutral};
+    };
+
+}; // namespace DataStructures
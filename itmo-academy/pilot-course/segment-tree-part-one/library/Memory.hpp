@@ -0,0 +1,35 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+
+#include "Types.hpp"
+
+namespace DataStructures
+{
+
+    struct MemoryFootprint
+    {
+        Long nodes{};
+        Long valueBytes{};
+        Long nodeBytes{};
+        Long slackBytes{};
+        Long totalBytes{};
+    };
+
+    inline Long AllocatedBytes(const Long &bytes) noexcept
+    {
+        return std::max(32LL, (bytes + 8 + 15) / 16 * 16);
+    }
+
+    inline std::ostream &operator<<(std::ostream &output, const MemoryFootprint &usage)
+    {
+        output << "nodes=" << usage.nodes;
+        output << " bytes/node=" << usage.nodeBytes;
+        output << " (value=" << usage.valueBytes;
+        output << ", links=" << usage.nodeBytes - usage.valueBytes << ')';
+        output << " slack=" << usage.slackBytes;
+        return output << " total=" << usage.totalBytes;
+    }
+
+}; // namespace DataStructures
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    class OrderedMultiset
+    {
+    public:
+        static constexpr const char *Name{"OrderedMultiset"};
+        static constexpr Int NPos{std::numeric_limits<Int>::max()};
+
+    public:
+        OrderedMultiset(const Int &l, const Int &r) noexcept : l{l}
+        {
+            for (capacity = 1, depth = 0; capacity < r - l + 1; capacity <<= 1, ++depth);
+            tree.assign(2 * capacity, 0);
+        }
+
+        void Insert(const Int &x, const Int &count = 1) noexcept
+        {
+            for (auto p{capacity + x - l}; p > 0; p >>= 1)
+            {
+                tree[p] += count;
+            }
+        }
+
+        bool Erase(const Int &x, Int count = 1) noexcept
+        {
+            count = std::min(count, Count(x));
+            for (auto p{capacity + x - l}; p > 0; p >>= 1)
+            {
+                tree[p] -= count;
+            }
+            return count != 0;
+        }
+
+        const Int &Count(const Int &x) const noexcept
+        {
+            return tree[capacity + x - l];
+        }
+
+        const Int &Size() const noexcept
+        {
+            return tree[1];
+        }
+
+        Int Rank(const Int &x) const noexcept
+        {
+            if (x < l)
+            {
+                return 0;
+            }
+            auto y{x - l};
+            if (y >= capacity)
+            {
+                return Size();
+            }
+            Int rank{}, p{1};
+            for (auto bit{depth}; bit-- > 0;)
+            {
+                p <<= 1;
+                if (y >> bit & 1)
+                {
+                    rank += tree[p];
+                    p |= 1;
+                }
+            }
+            return rank;
+        }
+
+        Int Select(Int k) const noexcept
+        {
+            if (k >= Size())
+            {
+                return NPos;
+            }
+            Int p{1};
+            while (p < capacity)
+            {
+                p <<= 1;
+                if (tree[p] <= k)
+                {
+                    k -= tree[p];
+                    p |= 1;
+                }
+            }
+            return l + p - capacity;
+        }
+
+        Int CountInRange(const Int &a, const Int &b) const noexcept
+        {
+            if (b < a)
+            {
+                return 0;
+            }
+            auto inside{l <= b && b - l < capacity};
+            return Rank(b) - Rank(a) + (inside ? Count(b) : 0);
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int i = 0; i < initial.size(); ++i)
+            {
+                tree[capacity + i] = initial[i];
+            }
+            for (auto p{capacity - 1}; p > 0; --p)
+            {
+                tree[p] = tree[2 * p] + tree[2 * p + 1];
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = tree.size();
+            usage.valueBytes = sizeof(Int);
+            usage.nodeBytes = sizeof(Int);
+            usage.totalBytes = AllocatedBytes(tree.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        std::vector<Int> tree{};
+        Int capacity{};
+        Int depth{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
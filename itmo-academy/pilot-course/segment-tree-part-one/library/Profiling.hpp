@@ -0,0 +1,399 @@
+#pragma once
+
+#include <type_traits>
+#include <algorithm>
+#include <iostream>
+#include <csignal>
+#include <utility>
+#include <chrono>
+#include <vector>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+#include "Types.hpp"
+
+namespace Profiling
+{
+
+#ifdef PROFILE_LATENCY
+    constexpr bool Enabled{true};
+#else
+    constexpr bool Enabled{false};
+#endif
+
+#ifdef PROFILE_MEMORY
+    constexpr bool MemoryEnabled{true};
+#else
+    constexpr bool MemoryEnabled{false};
+#endif
+
+    constexpr Int SampleEvery{1};
+
+    inline volatile std::sig_atomic_t ReportRequested{};
+
+    inline void RequestReport(int) noexcept
+    {
+        ReportRequested = 1;
+    }
+
+    class LatencyHistogram
+    {
+    public:
+        void Record(const Long &ns) noexcept
+        {
+            ++buckets[Bucket(ns)];
+            max = std::max(max, ns);
+            ++count;
+        }
+
+        Long Percentile(const double &p) const noexcept
+        {
+            Long seen{};
+            auto rank{static_cast<Long>(p / 100 * count)};
+            for (Int b = 0; b < Buckets; ++b)
+            {
+                seen += buckets[b];
+                if (seen > rank)
+                {
+                    return std::min(UpperBound(b), max);
+                }
+            }
+            return max;
+        }
+
+        const Long &Count() const noexcept
+        {
+            return count;
+        }
+
+        const Long &Max() const noexcept
+        {
+            return max;
+        }
+
+    private:
+        static constexpr Int Precision{5};
+        static constexpr Int SubBuckets{1u << Precision};
+        static constexpr Int Buckets{(65 - Precision) * SubBuckets};
+
+        static Int Bucket(const Long &ns) noexcept
+        {
+            auto v{static_cast<unsigned long long>(ns)};
+            if (v < SubBuckets)
+            {
+                return v;
+            }
+            auto e{static_cast<Int>(63 - __builtin_clzll(v))};
+            return (e - Precision + 1) * SubBuckets
+                + ((v >> (e - Precision)) & (SubBuckets - 1));
+        }
+
+        static Long UpperBound(const Int &b) noexcept
+        {
+            if (b < SubBuckets)
+            {
+                return b;
+            }
+            Int shift{b / SubBuckets - 1};
+            auto lower{(0ULL + SubBuckets + b % SubBuckets) << shift};
+            return lower + (1ULL << shift) - 1;
+        }
+
+    private:
+        Long buckets[Buckets]{};
+        Long count{};
+        Long max{};
+    };
+
+    template <typename Key>
+    class LatencyRecorder
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        LatencyRecorder() noexcept
+        {
+#ifdef SIGUSR1
+            if constexpr (Enabled)
+            {
+                std::signal(SIGUSR1, RequestReport);
+            }
+#endif
+        }
+
+        ~LatencyRecorder()
+        {
+            if constexpr (Enabled)
+            {
+                Report(std::cerr);
+            }
+        }
+
+        Clock::time_point Start() noexcept
+        {
+            if constexpr (Enabled)
+            {
+                if (++tick % SampleEvery == 0)
+                {
+                    return Clock::now();
+                }
+            }
+            return {};
+        }
+
+        void Stop(const Key &key, const Clock::time_point &start)
+        {
+            if constexpr (Enabled)
+            {
+                if (start != Clock::time_point{})
+                {
+                    auto i{static_cast<Int>(key)};
+                    if (histograms.size() <= i)
+                    {
+                        histograms.resize(i + 1);
+                    }
+                    auto elapsed{Clock::now() - start};
+                    histograms[i].Record(std::chrono::duration_cast<
+                        std::chrono::nanoseconds>(elapsed).count());
+                }
+                if (ReportRequested)
+                {
+                    ReportRequested = 0;
+                    Report(std::cerr);
+                }
+            }
+        }
+
+        void Report(std::ostream &output) const
+        {
+            for (Int i = 0; i < histograms.size(); ++i)
+            {
+                const auto &h{histograms[i]};
+                if (h.Count() == 0)
+                {
+                    continue;
+                }
+                output << static_cast<Key>(i) << ": n=" << h.Count();
+                output << " p50=" << h.Percentile(50);
+                output << " p90=" << h.Percentile(90);
+                output << " p99=" << h.Percentile(99);
+                output << " p99.9=" << h.Percentile(99.9);
+                output << " max=" << h.Max() << " ns\n";
+            }
+        }
+
+    private:
+        std::vector<LatencyHistogram> histograms{};
+        Int tick{};
+    };
+
+#ifdef PROFILE_COUNTERS
+    constexpr bool CountersEnabled{true};
+#else
+    constexpr bool CountersEnabled{false};
+#endif
+
+    enum class Phase : Int
+    {
+        Build,
+        Update,
+        Query
+    };
+
+    inline std::ostream &operator<<(std::ostream &output, const Phase &phase)
+    {
+        switch (phase)
+        {
+        case Phase::Build:
+            return output << "Build";
+        case Phase::Update:
+            return output << "Update";
+        case Phase::Query:
+            return output << "Query";
+        }
+        return output << static_cast<Int>(phase);
+    }
+
+    class PerformanceCounters
+    {
+    public:
+        PerformanceCounters() noexcept
+        {
+            if constexpr (CountersEnabled)
+            {
+                Open();
+            }
+        }
+
+        ~PerformanceCounters()
+        {
+            if constexpr (CountersEnabled)
+            {
+                Report(std::cerr);
+                Close();
+            }
+        }
+
+        void Start() noexcept
+        {
+            if constexpr (CountersEnabled)
+            {
+                Read(snapshot);
+            }
+        }
+
+        void Stop(const Phase &phase) noexcept
+        {
+            if constexpr (CountersEnabled)
+            {
+                Long current[Events]{};
+                Read(current);
+                auto &total{totals[static_cast<Int>(phase)]};
+                for (Int e = 0; e < Events; ++e)
+                {
+                    total[e] += current[e] - snapshot[e];
+                }
+            }
+        }
+
+        void Report(std::ostream &output) const
+        {
+            for (Int p = 0; p < Phases; ++p)
+            {
+                output << static_cast<Phase>(p) << ':';
+                for (Int e = 0; e < Events; ++e)
+                {
+                    output << ' ' << Names[e] << '=';
+                    if (fds[e] < 0)
+                    {
+                        output << "unavailable";
+                        continue;
+                    }
+                    output << totals[p][e];
+                }
+                output << '\n';
+            }
+        }
+
+    private:
+        static constexpr Int Phases{3};
+        static constexpr Int Events{5};
+
+        static constexpr const char *Names[Events]{
+            "cycles", "instructions", "L1-misses", "LLC-misses", "branch-misses"};
+
+        void Open() noexcept
+        {
+#ifdef __linux__
+            constexpr unsigned long long L1Miss{PERF_COUNT_HW_CACHE_L1D
+                | PERF_COUNT_HW_CACHE_OP_READ << 8
+                | PERF_COUNT_HW_CACHE_RESULT_MISS << 16};
+            const std::pair<Int, unsigned long long> events[Events]{
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HW_CACHE, L1Miss},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+            for (Int e = 0; e < Events; ++e)
+            {
+                perf_event_attr attributes{};
+                attributes.size = sizeof(attributes);
+                attributes.type = events[e].first;
+                attributes.config = events[e].second;
+                attributes.disabled = leader < 0;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+                attributes.read_format = PERF_FORMAT_GROUP;
+                fds[e] = syscall(SYS_perf_event_open, &attributes, 0, -1, leader, 0);
+                if (leader < 0)
+                {
+                    leader = fds[e];
+                }
+            }
+            if (leader >= 0)
+            {
+                ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+#endif
+        }
+
+        void Close() noexcept
+        {
+#ifdef __linux__
+            for (const auto &fd : fds)
+            {
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+        void Read(Long *values) const noexcept
+        {
+#ifdef __linux__
+            unsigned long long buffer[Events + 1]{};
+            if (leader < 0 || read(leader, buffer, sizeof(buffer)) <= 0)
+            {
+                return;
+            }
+            for (Int e = 0, k = 1; e < Events; ++e)
+            {
+                if (fds[e] >= 0)
+                {
+                    values[e] = buffer[k++];
+                }
+            }
+#endif
+        }
+
+    private:
+        Long totals[Phases][Events]{};
+        Long snapshot[Events]{};
+        int fds[Events]{-1, -1, -1, -1, -1};
+        int leader{-1};
+    };
+
+    template <typename Key>
+    class Profiler
+    {
+    public:
+        template <typename Action>
+        void Measure(const Phase &phase, const Action &action)
+        {
+            counters.Start();
+            action();
+            counters.Stop(phase);
+        }
+
+        template <typename Action>
+        auto Measure(const Key &key, const Phase &phase, const Action &action)
+        {
+            counters.Start();
+            auto start{latencies.Start()};
+            if constexpr (std::is_void<decltype(action())>::value)
+            {
+                action();
+                latencies.Stop(key, start);
+                counters.Stop(phase);
+            }
+            else
+            {
+                auto result{action()};
+                latencies.Stop(key, start);
+                counters.Stop(phase);
+                return result;
+            }
+        }
+
+    private:
+        PerformanceCounters counters{};
+        LatencyRecorder<Key> latencies{};
+    };
+
+}; // namespace Profiling
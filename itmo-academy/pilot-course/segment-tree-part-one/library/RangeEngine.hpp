@@ -0,0 +1,21 @@
+#pragma once
+
+#include <type_traits>
+
+#include "ColumnarSegmentTree.hpp"
+#include "DisjointSparseTable.hpp"
+#include "FlatSegmentTree.hpp"
+#include "FenwickTree.hpp"
+#include "SegmentTree.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid, bool Static = false>
+    using RangeEngine = std::conditional_t<Static, DisjointSparseTable<T, Monoid>,
+        std::conditional_t<Monoid::Invertible && Monoid::Commutative,
+        FenwickTree<T, Monoid>, std::conditional_t<Columnar<T>::value,
+        ColumnarSegmentTree<T, Monoid>, std::conditional_t<Monoid::Commutative,
+        FlatSegmentTree<T, Monoid>, SegmentTree<T, Monoid>>>>>;
+
+}; // namespace DataStructures
@@ -0,0 +1,497 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T>
+    class RangeInversions
+    {
+    public:
+        static constexpr const char *Name{"RangeInversions"};
+
+    public:
+        RangeInversions(const Int &l, const Int &r) noexcept
+            : trailing(r - l + 1), leading(r - l + 1), order(r - l + 1),
+              values(r - l + 1), sorted(r - l + 1), n{r - l + 1}, l{l}
+        {
+            for (size = 1; Long{size} * size < Long{BlockFactor} * BlockFactor * n; ++size);
+            size = std::max(size, MinimumBlock);
+            blocks = (n + size - 1) / size;
+            tree.resize(blocks + 1);
+            self.assign(blocks, 0);
+            rows.assign(static_cast<std::size_t>(blocks) * (blocks + 1), 0);
+        }
+
+        Long Query(const Int &l, const Int &r) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l + 1};
+            auto first{a / size}, last{(b - 1) / size};
+            if (first == last)
+            {
+                auto result{leading[b - 1] - Split(first, a, b)};
+                return a > Begin(first) ? result - leading[a - 1] : result;
+            }
+            Long result{trailing[a] + leading[b - 1] + Cross(first, a, last, b)};
+            if (first + 1 == last)
+            {
+                return result;
+            }
+            for (auto c{first + 1}; c < last; ++c)
+            {
+                result += self[c] + RowSum(c, last) - RowSum(c, c + 1);
+            }
+            if (End(first) - a <= a - Begin(first))
+            {
+                result += Dominated<true>(first + 1, last, first, a, End(first));
+            }
+            else
+            {
+                result += RowSum(first, last) - RowSum(first, first + 1);
+                result -= Dominated<true>(first + 1, last, first, Begin(first), a);
+            }
+            Long middle{Begin(last) - End(first)};
+            if (b - Begin(last) <= End(last) - b)
+            {
+                result += middle * (b - Begin(last)) - Dominated<false>(first + 1, last, last, Begin(last), b);
+            }
+            else
+            {
+                for (auto c{first + 1}; c < last; ++c)
+                {
+                    result += RowSum(c, last + 1) - RowSum(c, last);
+                }
+                result -= middle * (End(last) - b) - Dominated<false>(first + 1, last, last, b, End(last));
+            }
+            return result;
+        }
+
+        void Update(const Int &i, const T &u)
+        {
+            auto p{i - l}, b{p / size};
+            auto old{values[p]};
+            Long before{}, after{};
+            for (auto q{p}; q-- > Begin(b);)
+            {
+                before += (u < values[q]) - (old < values[q]);
+                trailing[q] += before;
+            }
+            for (auto q{p + 1}; q < End(b); ++q)
+            {
+                after += (values[q] < u) - (values[q] < old);
+                leading[q] += before + after;
+            }
+            for (auto q{Begin(b)}; q < p; ++q)
+            {
+                trailing[q] += after;
+            }
+            leading[p] += before;
+            trailing[p] += after;
+            self[b] += before + after;
+            values[p] = u;
+            Reorder(b, p, old, u);
+            for (Int c = 0; c < b; ++c)
+            {
+                AddCross(c, b, -Shift<false>(sorted.data() + Begin(c), size, old, u));
+            }
+            for (auto c{b + 1}; c < blocks; ++c)
+            {
+                AddCross(b, c, Shift<true>(sorted.data() + Begin(c), End(c) - Begin(c), old, u));
+            }
+            for (auto k{b + 1}; k <= blocks; k += k & -k)
+            {
+                Erase(tree[k], old);
+                Insert(tree[k], u);
+                Index(tree[k]);
+            }
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial)
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                values[i] = initial[i];
+                order[i] = i;
+            }
+            std::fill(rows.begin(), rows.end(), 0);
+            std::vector<Int> rank(size), counts(size + 1);
+            for (Int c = 0; c < blocks; ++c)
+            {
+                std::sort(order.begin() + Begin(c), order.begin() + End(c), [&](const Int &i, const Int &j)
+                {
+                    return Precedes(values[i], i, values[j], j);
+                });
+                for (auto k{Begin(c)}; k < End(c); ++k)
+                {
+                    sorted[k] = values[order[k]];
+                    rank[order[k] - Begin(c)] = k - Begin(c) + 1;
+                }
+                Long inversions{};
+                std::fill(counts.begin(), counts.end(), 0);
+                for (auto p{Begin(c)}; p < End(c); ++p)
+                {
+                    inversions += p - Begin(c) - Prefix(counts, rank[p - Begin(c)]);
+                    leading[p] = inversions;
+                    Insert(counts, rank[p - Begin(c)]);
+                }
+                self[c] = inversions;
+                inversions = 0;
+                std::fill(counts.begin(), counts.end(), 0);
+                for (auto p{End(c)}; p-- > Begin(c);)
+                {
+                    inversions += Prefix(counts, rank[p - Begin(c)]);
+                    trailing[p] = inversions;
+                    Insert(counts, rank[p - Begin(c)]);
+                }
+            }
+            std::vector<Int> global(n), seen(blocks);
+            for (Int i = 0; i < n; ++i)
+            {
+                global[i] = i;
+            }
+            std::sort(global.begin(), global.end(), [&](const Int &i, const Int &j)
+            {
+                return Precedes(values[i], i, values[j], j);
+            });
+            for (const auto &i : global)
+            {
+                auto c{i / size};
+                auto *row{rows.data() + static_cast<std::size_t>(c) * (blocks + 1) + 1};
+                for (auto d{c + 1}; d < blocks; ++d)
+                {
+                    row[d] += seen[d];
+                }
+                ++seen[c];
+            }
+            for (Int c = 0; c < blocks; ++c)
+            {
+                auto *row{rows.data() + static_cast<std::size_t>(c) * (blocks + 1)};
+                for (Int k = 1; k <= blocks; ++k)
+                {
+                    if (k + (k & -k) <= blocks)
+                    {
+                        row[k + (k & -k)] += row[k];
+                    }
+                }
+            }
+            std::vector<std::vector<T>> merged(blocks + 1);
+            for (Int k = 1; k <= blocks; ++k)
+            {
+                merged[k].assign(sorted.begin() + Begin(k - 1), sorted.begin() + End(k - 1));
+                for (Int s = 1; s < (k & -k); s <<= 1)
+                {
+                    std::vector<T> buffer(merged[k].size() + merged[k - s].size());
+                    std::merge(merged[k - s].begin(), merged[k - s].end(),
+                        merged[k].begin(), merged[k].end(), buffer.begin());
+                    merged[k].swap(buffer);
+                }
+            }
+            for (Int k = 1; k <= blocks; ++k)
+            {
+                tree[k].runs.clear();
+                for (Int s = 0, end = 0; s < merged[k].size(); s = end)
+                {
+                    end = merged[k].size() - s < size + size / 2 ? merged[k].size() : s + size;
+                    tree[k].runs.emplace_back(merged[k].begin() + s, merged[k].begin() + end);
+                }
+                Index(tree[k]);
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = n;
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = 2 * sizeof(T) + sizeof(Int) + 2 * sizeof(Long);
+            usage.totalBytes = AllocatedBytes(values.capacity() * sizeof(T))
+                + AllocatedBytes(sorted.capacity() * sizeof(T))
+                + AllocatedBytes(order.capacity() * sizeof(Int))
+                + AllocatedBytes(leading.capacity() * sizeof(Long))
+                + AllocatedBytes(trailing.capacity() * sizeof(Long))
+                + AllocatedBytes(self.capacity() * sizeof(Long))
+                + AllocatedBytes(rows.capacity() * sizeof(Long))
+                + AllocatedBytes(tree.capacity() * sizeof(Node));
+            for (const auto &node : tree)
+            {
+                usage.totalBytes += AllocatedBytes(node.runs.capacity() * sizeof(std::vector<T>))
+                    + AllocatedBytes(node.starts.capacity() * sizeof(Int));
+                for (const auto &run : node.runs)
+                {
+                    usage.totalBytes += AllocatedBytes(run.capacity() * sizeof(T));
+                }
+            }
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static constexpr Int Levels{8 * sizeof(Int)};
+        static constexpr Int MinimumBlock{64};
+        static constexpr Int BlockFactor{4};
+        static constexpr Int Chunk{256};
+
+        struct Node
+        {
+            std::vector<std::vector<T>> runs{};
+            std::vector<Int> starts{};
+        };
+
+        static bool Precedes(const T &x, const Int &i, const T &y, const Int &j) noexcept
+        {
+            return x < y || (!(y < x) && i < j);
+        }
+
+        template <bool Strict>
+        static bool Below(const T &y, const T &x) noexcept
+        {
+            return Strict ? y < x : !(x < y);
+        }
+
+        template <bool Strict>
+        static Long Shift(const T *first, Int length, const T &old, const T &u) noexcept
+        {
+            auto *from{first}, *to{first};
+            for (; length > 1; length -= length / 2)
+            {
+                from += Below<Strict>(from[length / 2], old) * (length / 2);
+                to += Below<Strict>(to[length / 2], u) * (length / 2);
+            }
+            return (to - from) + Below<Strict>(*to, u) - Below<Strict>(*from, old);
+        }
+
+        static Int Locate(const Node &node, const T &x) noexcept
+        {
+            auto run{std::partition_point(node.runs.begin(), node.runs.end() - 1,
+                [&](const std::vector<T> &run) { return run.back() < x; })};
+            return run - node.runs.begin();
+        }
+
+        static void Index(Node &node)
+        {
+            node.starts.resize(node.runs.size());
+            for (Int j = 0, start = 0; j < node.runs.size(); start += node.runs[j++].size())
+            {
+                node.starts[j] = start;
+            }
+        }
+
+        template <bool Strict>
+        static const T *Seek(const T *p, const T *end, const T &x) noexcept
+        {
+            auto below{[&](const T &y) { return Below<Strict>(y, x); }};
+            Long step{1};
+            for (; step < end - p && below(p[step]); step <<= 1)
+            {
+                p += step;
+            }
+            return std::partition_point(p, p + std::min<Long>(step, end - p), below);
+        }
+
+        static Int Prefix(const std::vector<Int> &counts, Int k) noexcept
+        {
+            Int sum{};
+            for (; k > 0; k &= k - 1)
+            {
+                sum += counts[k];
+            }
+            return sum;
+        }
+
+        static void Insert(std::vector<Int> &counts, Int k) noexcept
+        {
+            for (; k < counts.size(); k += k & -k)
+            {
+                ++counts[k];
+            }
+        }
+
+        void Erase(Node &node, const T &x)
+        {
+            auto j{Locate(node, x)};
+            auto &run{node.runs[j]};
+            run.erase(std::lower_bound(run.begin(), run.end(), x));
+            if (2 * run.size() < size && node.runs.size() > 1)
+            {
+                auto a{j + 1 < node.runs.size() ? j : j - 1};
+                auto &left{node.runs[a]}, &right{node.runs[a + 1]};
+                left.insert(left.end(), right.begin(), right.end());
+                node.runs.erase(node.runs.begin() + a + 1);
+                Split(node, a);
+            }
+        }
+
+        void Insert(Node &node, const T &x)
+        {
+            auto j{Locate(node, x)};
+            auto &run{node.runs[j]};
+            run.insert(std::upper_bound(run.begin(), run.end(), x), x);
+            Split(node, j);
+        }
+
+        void Split(Node &node, const Int &j)
+        {
+            auto &run{node.runs[j]};
+            if (run.size() <= 2 * size)
+            {
+                return;
+            }
+            std::vector<T> upper(run.begin() + run.size() / 2, run.end());
+            run.resize(run.size() / 2);
+            node.runs.insert(node.runs.begin() + j + 1, std::move(upper));
+        }
+
+        Int Begin(const Int &c) const noexcept
+        {
+            return c * size;
+        }
+
+        Int End(const Int &c) const noexcept
+        {
+            return std::min(n, c * size + size);
+        }
+
+        Long Split(const Int &c, const Int &a, const Int &b) const noexcept
+        {
+            Long count{}, seen{};
+            for (auto k{Begin(c)}; k < End(c); ++k)
+            {
+                if (order[k] < a)
+                {
+                    count += seen;
+                }
+                else if (order[k] < b)
+                {
+                    ++seen;
+                }
+            }
+            return count;
+        }
+
+        Long Cross(const Int &first, const Int &a, const Int &last, const Int &b) const noexcept
+        {
+            Long count{}, below{};
+            auto q{Begin(last)};
+            for (auto k{Begin(first)}; k < End(first); ++k)
+            {
+                if (order[k] < a)
+                {
+                    continue;
+                }
+                for (; q < End(last) && sorted[q] < sorted[k]; ++q)
+                {
+                    below += order[q] < b;
+                }
+                count += below;
+            }
+            return count;
+        }
+
+        template <bool Strict>
+        Long Dominated(Int lo, Int hi, const Int &c, const Int &a, const Int &b) const noexcept
+        {
+            const Node *targets[2 * Levels];
+            const T *cursors[2 * Levels];
+            Int indices[2 * Levels];
+            bool negative[2 * Levels];
+            Int nodes{};
+            while (lo != hi)
+            {
+                negative[nodes] = hi < lo;
+                auto &k{hi < lo ? lo : hi};
+                targets[nodes] = &tree[k];
+                cursors[nodes] = tree[k].runs.front().data();
+                indices[nodes++] = 0;
+                k &= k - 1;
+            }
+            T chunk[Chunk];
+            Long count{};
+            for (Int k = Begin(c), filled = 0; k < End(c) || filled > 0;)
+            {
+                for (; k < End(c) && filled < Chunk; ++k)
+                {
+                    chunk[filled] = sorted[k];
+                    filled += a <= order[k] && order[k] < b;
+                }
+                for (Int j = 0; j < nodes; ++j)
+                {
+                    const auto &runs{targets[j]->runs};
+                    auto &index{indices[j]};
+                    Long sum{};
+                    for (Int t = 0; t < filled; ++t)
+                    {
+                        for (; index + 1 < runs.size() && Below<Strict>(runs[index].back(), chunk[t]);)
+                        {
+                            cursors[j] = runs[++index].data();
+                        }
+                        const auto &run{runs[index]};
+                        cursors[j] = Seek<Strict>(cursors[j], run.data() + run.size(), chunk[t]);
+                        sum += targets[j]->starts[index] + (cursors[j] - run.data());
+                    }
+                    count += negative[j] ? -sum : sum;
+                }
+                filled = 0;
+            }
+            return count;
+        }
+
+        void Reorder(const Int &b, const Int &p, const T &old, const T &u) noexcept
+        {
+            auto k{static_cast<Int>(std::lower_bound(sorted.begin() + Begin(b),
+                sorted.begin() + End(b), old) - sorted.begin())};
+            for (; order[k] != p; ++k);
+            for (; k + 1 < End(b) && Precedes(sorted[k + 1], order[k + 1], u, p); ++k)
+            {
+                sorted[k] = sorted[k + 1];
+                order[k] = order[k + 1];
+            }
+            for (; k > Begin(b) && Precedes(u, p, sorted[k - 1], order[k - 1]); --k)
+            {
+                sorted[k] = sorted[k - 1];
+                order[k] = order[k - 1];
+            }
+            sorted[k] = u;
+            order[k] = p;
+        }
+
+        void AddCross(const Int &row, const Int &column, const Long &delta) noexcept
+        {
+            auto *sums{rows.data() + static_cast<std::size_t>(row) * (blocks + 1)};
+            for (auto k{column + 1}; k <= blocks; k += k & -k)
+            {
+                sums[k] += delta;
+            }
+        }
+
+        Long RowSum(const Int &row, Int column) const noexcept
+        {
+            const auto *sums{rows.data() + static_cast<std::size_t>(row) * (blocks + 1)};
+            Long sum{};
+            for (; column > 0; column &= column - 1)
+            {
+                sum += sums[column];
+            }
+            return sum;
+        }
+
+    private:
+        std::vector<Node> tree{};
+        std::vector<Long> trailing{};
+        std::vector<Long> leading{};
+        std::vector<Long> rows{};
+        std::vector<Long> self{};
+        std::vector<Int> order{};
+        std::vector<T> values{};
+        std::vector<T> sorted{};
+        Int blocks{};
+        Int size{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
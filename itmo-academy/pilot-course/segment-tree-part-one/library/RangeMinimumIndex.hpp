@@ -0,0 +1,137 @@
+#pragma once
+
+#include <functional>
+#include <algorithm>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Compare = std::less<T>>
+    class RangeMinimumIndex
+    {
+    public:
+        static constexpr const char *Name{"RangeMinimumIndex"};
+
+    public:
+        RangeMinimumIndex(const Int &l, const Int &r) noexcept
+            : masks(r - l + 1), values(r - l + 1), n{r - l + 1}, l{l} {}
+
+        Int Index(const Int &l, const Int &r) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l};
+            auto first{a / Width}, last{b / Width};
+            if (first == last)
+            {
+                return this->l + InBlock(a, b);
+            }
+            auto best{InBlock(a, first * Width + Width - 1)};
+            if (first + 1 < last)
+            {
+                best = Better(best, Blocks(first + 1, last - 1));
+            }
+            return this->l + Better(best, InBlock(last * Width, b));
+        }
+
+        const T &Query(const Int &l, const Int &r) const noexcept
+        {
+            return values[Index(l, r) - this->l];
+        }
+
+        const T &At(const Int &i) const noexcept
+        {
+            return values[i - l];
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                values[i] = initial[i];
+            }
+            for (Int s = 0; s < n; s += Width)
+            {
+                unsigned long long stack{};
+                for (auto i{s}; i < std::min(s + Width, n); ++i)
+                {
+                    while (stack && compare(values[i], values[s + Top(stack)]))
+                    {
+                        stack ^= 1ULL << Top(stack);
+                    }
+                    masks[i] = stack |= 1ULL << (i - s);
+                }
+            }
+            Int blocks{(n + Width - 1) / Width};
+            sparse.resize(blocks);
+            for (Int j = 0; j < blocks; ++j)
+            {
+                sparse[j] = InBlock(j * Width, std::min(j * Width + Width, n) - 1);
+            }
+            for (Int k = 1, offset = 0; (1u << k) <= blocks; offset += blocks, ++k)
+            {
+                sparse.resize(offset + 2 * blocks);
+                for (Int j = 0; j + (1u << k) <= blocks; ++j)
+                {
+                    sparse[offset + blocks + j] = Better(sparse[offset + j],
+                        sparse[offset + j + (1u << (k - 1))]);
+                }
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = n;
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = sizeof(T) + sizeof(unsigned long long);
+            usage.totalBytes = AllocatedBytes(values.capacity() * sizeof(T))
+                + AllocatedBytes(masks.capacity() * sizeof(unsigned long long))
+                + AllocatedBytes(sparse.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static constexpr Int Width{64};
+
+        static Int Top(const unsigned long long &stack) noexcept
+        {
+            return 63 - __builtin_clzll(stack);
+        }
+
+        Int Better(const Int &i, const Int &j) const noexcept
+        {
+            return compare(values[j], values[i]) ? j : i;
+        }
+
+        Int InBlock(const Int &a, const Int &b) const noexcept
+        {
+            auto s{b / Width * Width};
+            return s + __builtin_ctzll(masks[b] & (~0ULL << (a - s)));
+        }
+
+        Int Blocks(const Int &x, const Int &y) const noexcept
+        {
+            Int k{31u - __builtin_clz(y - x + 1)};
+            const auto *level{sparse.data() + static_cast<std::size_t>(k) * Blocks()};
+            return Better(level[x], level[y + 1 - (1u << k)]);
+        }
+
+        Int Blocks() const noexcept
+        {
+            return (n + Width - 1) / Width;
+        }
+
+    private:
+        std::vector<unsigned long long> masks{};
+        std::vector<Int> sparse{};
+        std::vector<T> values{};
+        Compare compare{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid>
+    class SegmentTree
+    {
+    public:
+        static constexpr const char *Name{"SegmentTree"};
+        static constexpr Int NPos{std::numeric_limits<Int>::max()};
+
+    public:
+        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            if (Disjoint(l, r))
+            {
+                return;
+            }
+            if (Contained(l, r))
+            {
+                Monoid::Accumulate(accumulator, value);
+                return;
+            }
+            left->QueryInto(l, r, accumulator);
+            right->QueryInto(l, r, accumulator);
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            auto result{Monoid::Identity()};
+            QueryInto(l, r, result);
+            return result;
+        }
+
+        template <typename Predicate>
+        Int MaxRight(const Int &l, const Predicate &predicate) const noexcept
+        {
+            auto accumulator{Monoid::Identity()};
+            return MaxRight(l, predicate, accumulator);
+        }
+
+        template <typename Predicate>
+        Int MinLeft(const Int &r, const Predicate &predicate) const noexcept
+        {
+            auto accumulator{Monoid::Identity()};
+            return MinLeft(r, predicate, accumulator);
+        }
+
+        Int FirstAtLeast(const T &x) const noexcept
+        {
+            return FirstAtLeast(l, x);
+        }
+
+        Int FirstAtLeast(const Int &i, const T &x) const noexcept
+        {
+            return MaxRight(i, [&x](const T &maximum) { return maximum < x; });
+        }
+
+        Int FirstAtLeast(const Int &l, const Int &r, const T &x) const noexcept
+        {
+            auto index{FirstAtLeast(l, x)};
+            return index <= r ? index : NPos;
+        }
+
+        Int LastAtLeast(const Int &i, const T &x) const noexcept
+        {
+            return MinLeft(i, [&x](const T &maximum) { return maximum < x; });
+        }
+
+        Int LastAtLeast(const Int &l, const Int &r, const T &x) const noexcept
+        {
+            auto index{LastAtLeast(r, x)};
+            return index != NPos && l <= index ? index : NPos;
+        }
+
+        template <typename Callback>
+        Int ReportAtLeast(const Int &l, const Int &r, const T &x,
+            const Callback &callback, const Int &limit = NPos) const
+        {
+            auto remaining{limit};
+            CollectAtLeast(l, r, x, callback, remaining);
+            return limit - remaining;
+        }
+
+        const T &Update(const Int &i, const T &u) noexcept
+        {
+            if (Disjoint(i, i))
+            {
+                return value;
+            }
+            if (Contained(i, i))
+            {
+                return value = u;
+            }
+            return value = Monoid::Combine(
+                left->Update(i, u), right->Update(i, u));
+        }
+
+        const T &Add(const Int &i, const T &u) noexcept
+        {
+            if (Disjoint(i, i))
+            {
+                return value;
+            }
+            if (Contained(i, i))
+            {
+                return value = Monoid::Combine(value, u);
+            }
+            return value = Monoid::Combine(
+                left->Add(i, u), right->Add(i, u));
+        }
+
+        template <typename Sequence>
+        const T &Build(const Sequence &initial) noexcept
+        {
+            auto h{(l + r) / 2};
+            if (!this->IsLeaf())
+            {
+                left.reset(new SegmentTree(l, h++));
+                right.reset(new SegmentTree(h, r));
+                value = Monoid::Combine(
+                    left->Build(initial), right->Build(initial));
+            }
+            else
+            {
+                value = initial[h];
+            }
+            return value;
+        }
+
+        const T &Build() noexcept
+        {
+            auto h{(l + r) / 2};
+            if (!this->IsLeaf())
+            {
+                left.reset(new SegmentTree(l, h++));
+                right.reset(new SegmentTree(h, r));
+                value = Monoid::Combine(left->Build(), right->Build());
+            }
+            else
+            {
+                value = Monoid::Identity();
+            }
+            return value;
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = CountNodes();
+            usage.valueBytes = sizeof(T);
+            usage.nodeBytes = sizeof(SegmentTree);
+            auto allocated{AllocatedBytes(sizeof(SegmentTree))};
+            usage.slackBytes = usage.nodes * (allocated - usage.nodeBytes);
+            usage.totalBytes = usage.nodes * allocated;
+            return usage;
+        }
+
+    private:
+        template <typename Predicate>
+        Int MaxRight(const Int &l, const Predicate &predicate, T &accumulator) const noexcept
+        {
+            if (r < l)
+            {
+                return NPos;
+            }
+            if (l <= this->l)
+            {
+                auto combined{Monoid::Combine(accumulator, value)};
+                if (predicate(combined))
+                {
+                    accumulator = combined;
+                    return NPos;
+                }
+                if (IsLeaf())
+                {
+                    return this->l;
+                }
+            }
+            auto index{left->MaxRight(l, predicate, accumulator)};
+            if (index == NPos)
+            {
+                return right->MaxRight(l, predicate, accumulator);
+            }
+            return index;
+        }
+
+        template <typename Predicate>
+        Int MinLeft(const Int &r, const Predicate &predicate, T &accumulator) const noexcept
+        {
+            if (r < l)
+            {
+                return NPos;
+            }
+            if (this->r <= r)
+            {
+                auto combined{Monoid::Combine(value, accumulator)};
+                if (predicate(combined))
+                {
+                    accumulator = combined;
+                    return NPos;
+                }
+                if (IsLeaf())
+                {
+                    return this->r;
+                }
+            }
+            auto index{right->MinLeft(r, predicate, accumulator)};
+            if (index == NPos)
+            {
+                return left->MinLeft(r, predicate, accumulator);
+            }
+            return index;
+        }
+
+        template <typename Callback>
+        void CollectAtLeast(const Int &l, const Int &r, const T &x,
+            const Callback &callback, Int &remaining) const
+        {
+            if (remaining == 0 || Disjoint(l, r) || value < x)
+            {
+                return;
+            }
+            if (IsLeaf())
+            {
+                callback(this->l);
+                --remaining;
+                return;
+            }
+            left->CollectAtLeast(l, r, x, callback, remaining);
+            right->CollectAtLeast(l, r, x, callback, remaining);
+        }
+
+        bool Contained(const Int &l, const Int &r) const noexcept
+        {
+            return l <= this->l && this->r <= r;
+        }
+
+        bool Disjoint(const Int &l, const Int &r) const noexcept
+        {
+            return r < this->l || this->r < l;
+        }
+
+        bool IsLeaf() const noexcept
+        {
+            return l == r;
+        }
+
+        Long CountNodes() const noexcept
+        {
+            if (!left)
+            {
+                return 1;
+            }
+            return 1 + left->CountNodes() + right->CountNodes();
+        }
+
+    private:
+        std::unique_ptr<SegmentTree> right{};
+        std::unique_ptr<SegmentTree> left{};
+        T value{};
+        Int l{};
+        Int r{};
+    };
+
+}; // namespace DataStructures
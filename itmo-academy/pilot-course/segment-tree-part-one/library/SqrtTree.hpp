@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T, typename Monoid>
+    class SqrtTree
+    {
+    public:
+        static constexpr const char *Name{"SqrtTree"};
+
+    public:
+        SqrtTree(const Int &l, const Int &r) noexcept : n{r - l + 1}, l{l}
+        {
+            for (lg = 0; (1u << lg) < n; ++lg);
+            width.assign((1u << lg) + 1, 0);
+            for (Int i = 1; i < width.size(); ++i)
+            {
+                width[i] = width[i >> 1] + 1;
+            }
+            onLayer.assign(lg + 1, 0);
+            for (auto t{lg}; t > 1; t = (t + 1) >> 1)
+            {
+                onLayer[t] = layers.size();
+                layers.push_back(t);
+            }
+            for (auto i{lg}; i-- > 0;)
+            {
+                onLayer[i] = std::max(onLayer[i], onLayer[i + 1]);
+            }
+            auto blockLog{(lg + 1) >> 1};
+            indexSize = (n + (1u << blockLog) - 1) >> blockLog;
+            values.assign(n + indexSize, Monoid::Identity());
+            prefix.assign(layers.size(), std::vector<T>(n + indexSize, Monoid::Identity()));
+            suffix.assign(layers.size(), std::vector<T>(n + indexSize, Monoid::Identity()));
+            between.assign(layers.empty() ? 0 : layers.size() - 1,
+                std::vector<T>((1u << lg) + (1u << blockLog), Monoid::Identity()));
+        }
+
+        void Update(const Int &i, const T &u) noexcept
+        {
+            values[i - l] = u;
+            Update(0, 0, n, 0, i - l);
+        }
+
+        void QueryInto(const Int &l, const Int &r, T &accumulator) const noexcept
+        {
+            Monoid::Accumulate(accumulator, Query(l, r));
+        }
+
+        T Query(const Int &l, const Int &r) const noexcept
+        {
+            return Query(l - this->l, r - this->l, 0, 0);
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
+        {
+            for (Int i = 0; i < n; ++i)
+            {
+                values[i] = initial[i];
+            }
+            Build(0, 0, n, 0);
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = n;
+            usage.valueBytes = sizeof(T);
+            usage.totalBytes = AllocatedBytes(values.capacity() * sizeof(T));
+            for (Int k = 0; k < layers.size(); ++k)
+            {
+                usage.totalBytes += AllocatedBytes(prefix[k].capacity() * sizeof(T))
+                    + AllocatedBytes(suffix[k].capacity() * sizeof(T));
+            }
+            for (const auto &layer : between)
+            {
+                usage.totalBytes += AllocatedBytes(layer.capacity() * sizeof(T));
+            }
+            usage.nodeBytes = usage.totalBytes / std::max(n, 1u);
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        void BuildBlock(const Int &layer, const Int &l, const Int &r) noexcept
+        {
+            prefix[layer][l] = values[l];
+            for (auto i{l + 1}; i < r; ++i)
+            {
+                prefix[layer][i] = Monoid::Combine(prefix[layer][i - 1], values[i]);
+            }
+            suffix[layer][r - 1] = values[r - 1];
+            for (auto i{r - 1}; i-- > l;)
+            {
+                suffix[layer][i] = Monoid::Combine(values[i], suffix[layer][i + 1]);
+            }
+        }
+
+        void BuildBetween(const Int &layer, const Int &lBound, const Int &rBound,
+            const Int &offset) noexcept
+        {
+            auto blockLog{(layers[layer] + 1) >> 1};
+            auto countLog{layers[layer] >> 1};
+            auto blocks{(rBound - lBound + (1u << blockLog) - 1) >> blockLog};
+            auto &level{between[layer - 1]};
+            for (Int i = 0; i < blocks; ++i)
+            {
+                auto product{suffix[layer][lBound + (i << blockLog)]};
+                level[offset + lBound + (i << countLog) + i] = product;
+                for (auto j{i + 1}; j < blocks; ++j)
+                {
+                    product = Monoid::Combine(product, suffix[layer][lBound + (j << blockLog)]);
+                    level[offset + lBound + (i << countLog) + j] = product;
+                }
+            }
+        }
+
+        void BuildIndex() noexcept
+        {
+            auto blockLog{(lg + 1) >> 1};
+            for (Int i = 0; i < indexSize; ++i)
+            {
+                values[n + i] = suffix[0][i << blockLog];
+            }
+            Build(1, n, n + indexSize, (1u << lg) - n);
+        }
+
+        void UpdateIndex(const Int &block) noexcept
+        {
+            auto blockLog{(lg + 1) >> 1};
+            values[n + block] = suffix[0][block << blockLog];
+            Update(1, n, n + indexSize, (1u << lg) - n, n + block);
+        }
+
+        void Build(const Int &layer, const Int &lBound, const Int &rBound,
+            const Int &offset) noexcept
+        {
+            if (layer >= layers.size())
+            {
+                return;
+            }
+            auto size{1u << ((layers[layer] + 1) >> 1)};
+            for (auto l{lBound}; l < rBound; l += size)
+            {
+                auto r{std::min(l + size, rBound)};
+                BuildBlock(layer, l, r);
+                Build(layer + 1, l, r, offset);
+            }
+            if (layer == 0)
+            {
+                BuildIndex();
+            }
+            else
+            {
+                BuildBetween(layer, lBound, rBound, offset);
+            }
+        }
+
+        void Update(const Int &layer, const Int &lBound, const Int &rBound,
+            const Int &offset, const Int &x) noexcept
+        {
+            if (layer >= layers.size())
+            {
+                return;
+            }
+            auto blockLog{(layers[layer] + 1) >> 1};
+            auto block{(x - lBound) >> blockLog};
+            auto l{lBound + (block << blockLog)};
+            auto r{std::min(l + (1u << blockLog), rBound)};
+            BuildBlock(layer, l, r);
+            if (layer == 0)
+            {
+                UpdateIndex(block);
+            }
+            else
+            {
+                BuildBetween(layer, lBound, rBound, offset);
+            }
+            Update(layer + 1, l, r, offset, x);
+        }
+
+        T Query(const Int &l, const Int &r, const Int &offset, const Int &base) const noexcept
+        {
+            if (l == r)
+            {
+                return values[l];
+            }
+            if (l + 1 == r)
+            {
+                return Monoid::Combine(values[l], values[r]);
+            }
+            auto layer{onLayer[width[(l - base) ^ (r - base)]]};
+            auto blockLog{(layers[layer] + 1) >> 1};
+            auto countLog{layers[layer] >> 1};
+            auto lBound{(((l - base) >> layers[layer]) << layers[layer]) + base};
+            auto first{((l - lBound) >> blockLog) + 1};
+            auto last{(r - lBound) >> blockLog};
+            auto result{suffix[layer][l]};
+            if (first < last)
+            {
+                result = Monoid::Combine(result, layer == 0
+                    ? Query(n + first, n + last - 1, (1u << lg) - n, n)
+                    : between[layer - 1][offset + lBound + (first << countLog) + last - 1]);
+            }
+            return Monoid::Combine(result, prefix[layer][r]);
+        }
+
+    private:
+        std::vector<std::vector<T>> between{};
+        std::vector<std::vector<T>> prefix{};
+        std::vector<std::vector<T>> suffix{};
+        std::vector<Int> onLayer{};
+        std::vector<Int> layers{};
+        std::vector<Int> width{};
+        std::vector<T> values{};
+        Int indexSize{};
+        Int lg{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
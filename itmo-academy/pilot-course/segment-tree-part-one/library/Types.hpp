@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Types
+{
+
+    using Long = long long int;
+    using Int = unsigned int;
+
+}; // namespace Types
+
+using namespace Types;
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <type_traits>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Memory.hpp"
+
+namespace DataStructures
+{
+
+    template <typename T>
+    class WaveletMatrix
+    {
+        static_assert(std::is_unsigned<T>::value);
+
+    public:
+        static constexpr const char *Name{"WaveletMatrix"};
+
+    public:
+        WaveletMatrix(const Int &l, const Int &r) noexcept : n{r - l + 1}, l{l} {}
+
+        T KthSmallest(const Int &l, const Int &r, Int k) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l + 1};
+            T result{};
+            for (auto bit{levels.size()}; bit-- > 0;)
+            {
+                const auto &level{levels[levels.size() - 1 - bit]};
+                auto zerosA{a - level.Rank(a)}, zerosB{b - level.Rank(b)};
+                if (k < zerosB - zerosA)
+                {
+                    a = zerosA, b = zerosB;
+                    continue;
+                }
+                k -= zerosB - zerosA;
+                result |= T{1} << bit;
+                a = level.zeros + a - zerosA, b = level.zeros + b - zerosB;
+            }
+            return result;
+        }
+
+        Int CountLess(const Int &l, const Int &r, const T &x) const noexcept
+        {
+            auto a{l - this->l}, b{r - this->l + 1};
+            if (levels.size() < std::numeric_limits<T>::digits && x >> levels.size())
+            {
+                return b - a;
+            }
+            Int count{};
+            for (auto bit{levels.size()}; bit-- > 0;)
+            {
+                const auto &level{levels[levels.size() - 1 - bit]};
+                auto zerosA{a - level.Rank(a)}, zerosB{b - level.Rank(b)};
+                if (x >> bit & 1)
+                {
+                    count += zerosB - zerosA;
+                    a = level.zeros + a - zerosA, b = level.zeros + b - zerosB;
+                }
+                else
+                {
+                    a = zerosA, b = zerosB;
+                }
+            }
+            return count;
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial)
+        {
+            std::vector<T> current(initial.begin(), initial.begin() + n), next(n);
+            T high{};
+            for (const auto &value : current)
+            {
+                high |= value;
+            }
+            Int depth{1};
+            for (; depth < std::numeric_limits<T>::digits && high >> depth; ++depth);
+            levels.assign(depth, Level(n));
+            for (auto bit{depth}; bit-- > 0;)
+            {
+                auto &level{levels[depth - 1 - bit]};
+                for (Int i = 0; i < n; ++i)
+                {
+                    level.words[i / Width] |= static_cast<unsigned long long>(current[i] >> bit & 1) << (i % Width);
+                }
+                for (Int w = 0; w < level.words.size(); ++w)
+                {
+                    level.ranks[w / Words + 1] += __builtin_popcountll(level.words[w]);
+                }
+                for (Int s = 1; s < level.ranks.size(); ++s)
+                {
+                    level.ranks[s] += level.ranks[s - 1];
+                }
+                level.zeros = n - level.ranks.back();
+                Int zeros{}, ones{level.zeros};
+                for (Int i = 0; i < n; ++i)
+                {
+                    next[current[i] >> bit & 1 ? ones++ : zeros++] = current[i];
+                }
+                current.swap(next);
+            }
+        }
+
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = n;
+            for (const auto &level : levels)
+            {
+                usage.totalBytes += AllocatedBytes(level.words.capacity() * sizeof(unsigned long long))
+                    + AllocatedBytes(level.ranks.capacity() * sizeof(Int));
+            }
+            usage.nodeBytes = usage.totalBytes / std::max(n, 1u);
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static constexpr Int Width{64};
+        static constexpr Int Words{8};
+
+        struct Level
+        {
+            explicit Level(const Int &n)
+                : words((n + Width - 1) / Width), ranks((words.size() + Words - 1) / Words + 1) {}
+
+            Int Rank(const Int &i) const noexcept
+            {
+                auto w{i / Width}, s{w / Words};
+                auto rank{ranks[s]};
+                for (auto v{s * Words}; v < w; ++v)
+                {
+                    rank += __builtin_popcountll(words[v]);
+                }
+                auto mask{(1ULL << (i % Width)) - 1};
+                return rank + __builtin_popcountll(i % Width ? words[w] & mask : 0);
+            }
+
+            std::vector<unsigned long long> words{};
+            std::vector<Int> ranks{};
+            Int zeros{};
+        };
+
+    private:
+        std::vector<Level> levels{};
+        Int n{};
+        Int l{};
+    };
+
+}; // namespace DataStructures
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Inline the library headers a driver includes into one submission file.
+
+    python3 library/bundle.py "step-one/A - Segment Tree for the Sum/SegmentTree.cpp" > Submission.cpp
+"""
+
+import os
+import re
+import sys
+
+LOCAL = re.compile(r'\s*#\s*include\s+"([^"]+)"')
+SYSTEM = re.compile(r'\s*#\s*include\s+<([^>]+)>')
+OPEN = re.compile(r'\s*#\s*if')
+CLOSE = re.compile(r'\s*#\s*endif')
+ONCE = re.compile(r'\s*#\s*pragma\s+once')
+
+
+def Expand(path, seen, headers, body):
+    path = os.path.realpath(path)
+    if path in seen:
+        return
+    seen.add(path)
+    depth = 0
+    with open(path) as source:
+        for line in source:
+            if ONCE.match(line):
+                continue
+            local = LOCAL.match(line)
+            if local:
+                Expand(os.path.join(os.path.dirname(path), local.group(1)), seen, headers, body)
+                continue
+            system = SYSTEM.match(line)
+            if system and depth == 0:
+                headers.add(system.group(1))
+                continue
+            if OPEN.match(line):
+                depth += 1
+            elif CLOSE.match(line):
+                depth -= 1
+            body.append(line.rstrip('\n'))
+
+
+def Bundle(path):
+    headers, body = set(), []
+    Expand(path, set(), headers, body)
+    lines = ['#include <%s>' % header for header in sorted(headers, key=lambda h: (-len(h), h))]
+    for line in body:
+        if line or (lines and lines[-1]):
+            lines.append(line)
+    return '\n'.join(lines).strip('\n') + '\n'
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        sys.exit('usage: bundle.py <driver.cpp>')
+    sys.stdout.write(Bundle(sys.argv[1]))
@@ -1,136 +1,198 @@
 #include <type_traits>
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
+#include "../../library/RangeEngine.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Algebra.hpp"
 
-using namespace Types;
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
-namespace DataStructures
+namespace Math
 {
 
+    template <typename T, typename = void>
+    struct LazyReduction : std::false_type
+    {
+    };
+
     template <typename T>
-    class SegmentTree
+    struct LazyReduction<T, std::void_t<typename T::Wide>> : std::true_type
     {
+    };
+
+    template <typename T, Int N>
+    class SquareMatrix
+    {
+    public:
+        static constexpr bool Commutative{false};
+        static constexpr bool Idempotent{false};
+        static constexpr bool Invertible{false};
+
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+        SquareMatrix() = default;
 
-        T Query(const Int &l, const Int &r) const noexcept
+        SquareMatrix operator*(const SquareMatrix &other) const noexcept
         {
-            if (Disjoint(l, r))
-            {
-                return T::Identity();
-            }
-            if (Contained(l, r))
+            SquareMatrix result{};
+            for (Int i = 0; i < N; ++i)
             {
-                return value;
+                MultiplyRow(matrix[i], other, result.matrix[i]);
             }
-            return left->Query(l, r)
-                * right->Query(l, r);
+            return result;
         }
 
-        template <typename Sequence>
-        T Build(const Sequence &initial) noexcept
+        SquareMatrix &operator*=(const SquareMatrix &other) noexcept
         {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    * right->Build(initial);
-            }
-            else
+            for (Int i = 0; i < N; ++i)
             {
-                value = initial[h];
+                T row[N]{};
+                std::copy(matrix[i], matrix[i] + N, row);
+                MultiplyRow(row, other, matrix[i]);
             }
-            return value;
+            return *this;
         }
 
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
+        static SquareMatrix Identity() noexcept
         {
-            return r < this->l || this->r < l;
+            SquareMatrix matrix{};
+            for (Int i = 0; i < N; ++i)
+            {
+                matrix[i][i] = 1;
+            }
+            return matrix;
         }
 
-        bool IsLeaf() const noexcept
+        T *operator[](const Int &i) noexcept
         {
-            return l == r;
+            return matrix[i];
         }
 
     private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-}; // namespace DataStructures
+        static constexpr Int UnrollLimit{4};
+        static constexpr Int Lanes{4};
+        static constexpr Int Block{4 * Lanes};
 
-namespace Math
-{
-
-    template <typename T, Int N>
-    class SquareMatrix
-    {
-    public:
-        SquareMatrix() = default;
-
-        SquareMatrix operator*(const SquareMatrix &other) noexcept
+        static void MultiplyRow(const T *row, const SquareMatrix &other, T *out) noexcept
         {
-            SquareMatrix result{};
-            for (Int i = 0; i < N; ++i)
+            if constexpr (!LazyReduction<T>::value)
             {
                 for (Int j = 0; j < N; ++j)
                 {
+                    T sum{};
                     for (Int k = 0; k < N; ++k)
                     {
-                        result[i][j] += matrix[i][k] * other.matrix[k][j];
+                        sum += row[k] * other.matrix[k][j];
                     }
+                    out[j] = sum;
                 }
             }
-            return result;
+            else if constexpr (N <= UnrollLimit)
+            {
+                for (Int j = 0; j < N; ++j)
+                {
+                    out[j] = Dot(row, other, j, std::make_integer_sequence<Int, N>{});
+                }
+            }
+            else
+            {
+                MultiplyBlocked(row, other, out);
+            }
         }
 
-        static SquareMatrix Identity() noexcept
+        template <Int... K>
+        static T Dot(const T *row, const SquareMatrix &other, const Int &j,
+            std::integer_sequence<Int, K...>) noexcept
         {
-            SquareMatrix matrix{};
-            for (Int i = 0; i < N; ++i)
+            typename T::Wide accumulator{};
+            (T::Accumulate(accumulator, row[K], other.matrix[K][j]), ...);
+            return T::Reduce(accumulator);
+        }
+
+        static void MultiplyBlocked(const T *row, const SquareMatrix &other, T *out) noexcept
+        {
+            Int j{};
+#ifdef __AVX2__
+            if constexpr (sizeof(T) == 4 && sizeof(typename T::Value) == 4)
             {
-                matrix[i][i] = 1;
+                if (T::Modulo() <= std::numeric_limits<int>::max())
+                {
+                    for (; j + Block <= N; j += Block)
+                    {
+                        MultiplyBlockAVX2(row, other, out, j);
+                    }
+                }
+            }
+#endif
+            typename T::Wide accumulator[N]{};
+            const auto square{T::Square()};
+            for (Int k = 0; k < N; ++k)
+            {
+                for (Int c = j; c < N; ++c)
+                {
+                    T::Accumulate(accumulator[c], row[k], other.matrix[k][c], square);
+                }
+            }
+            for (; j < N; ++j)
+            {
+                out[j] = T::Reduce(accumulator[j]);
             }
-            return matrix;
         }
 
-        T *operator[](const Int &i) noexcept
+#ifdef __AVX2__
+        static void MultiplyBlockAVX2(const T *row, const SquareMatrix &other, T *out,
+            const Int &j) noexcept
         {
-            return matrix[i];
+            static_assert(sizeof(T) == 4 && sizeof(typename T::Value) == 4);
+            static_assert(sizeof(typename T::Wide) == 8);
+            const auto square{_mm256_set1_epi64x(T::Square())};
+            const auto limit{_mm256_set1_epi64x(T::Square() - 1)};
+            __m256i accumulator[Block / Lanes]{};
+            for (Int k = 0; k < N; ++k)
+            {
+                const auto a{_mm256_set1_epi64x(static_cast<typename T::Value>(row[k]))};
+                const auto *b{reinterpret_cast<const __m128i *>(&other.matrix[k][j])};
+                for (Int v = 0; v < Block / Lanes; ++v)
+                {
+                    auto product{_mm256_mul_epu32(a, _mm256_cvtepu32_epi64(_mm_loadu_si128(b + v)))};
+                    auto sum{_mm256_add_epi64(accumulator[v], product)};
+                    auto excess{_mm256_cmpgt_epi64(sum, limit)};
+                    accumulator[v] = _mm256_sub_epi64(sum, _mm256_and_si256(excess, square));
+                }
+            }
+            typename T::Wide lanes[Block]{};
+            for (Int v = 0; v < Block / Lanes; ++v)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes + v * Lanes), accumulator[v]);
+            }
+            for (Int c = 0; c < Block; ++c)
+            {
+                out[j + c] = T::Reduce(lanes[c]);
+            }
         }
+#endif
 
     private:
         T matrix[N][N]{};
     };
 
-    template <typename T>
+    template <typename T, T Mod = 0>
     class ModInt
     {
         static_assert(std::is_integral<T>::value);
+        static_assert(sizeof(T) <= 4);
 
     public:
-        ModInt(const T &value) : value{value % mod} {}
+        using Value = T;
+        using Wide = unsigned long long;
+
+    public:
+        ModInt(const T &value) noexcept : value{Remainder(value)} {}
 
         ModInt() = default;
 
@@ -139,17 +201,63 @@ namespace Math
 
         ModInt operator*(const ModInt &other) const noexcept
         {
-            return {value * other.value};
+            return Reduce(Wide{value} * other.value);
         }
 
         ModInt &operator+=(const ModInt &other) noexcept
         {
-            return *this = {value + other.value};
+            Wide sum{Wide{value} + other.value};
+            value = sum < Modulo() ? sum : sum - Modulo();
+            return *this;
+        }
+
+        static void Accumulate(Wide &accumulator, const ModInt &a, const ModInt &b,
+            const Wide &square = Square()) noexcept
+        {
+            Wide product{Wide{a.value} * b.value};
+            accumulator += product;
+            if (accumulator < product || accumulator >= square)
+            {
+                accumulator -= square;
+            }
+        }
+
+        static ModInt Reduce(const Wide &x) noexcept
+        {
+            ModInt result{};
+            result.value = Remainder(x);
+            return result;
         }
 
         static void SetModulo(const T &mod) noexcept
         {
+            static_assert(Mod == 0, "the modulus is fixed at compile time");
             ModInt::mod = mod;
+            ModInt::factor = ~Wide{} / mod;
+            ModInt::square = Wide{mod} * mod;
+        }
+
+        static constexpr bool IsStatic() noexcept
+        {
+            return Mod != 0;
+        }
+
+        static Wide Modulo() noexcept
+        {
+            if constexpr (IsStatic())
+            {
+                return Mod;
+            }
+            return mod;
+        }
+
+        static Wide Square() noexcept
+        {
+            if constexpr (IsStatic())
+            {
+                return Wide{Mod} * Mod;
+            }
+            return square;
         }
 
         operator const T &() const noexcept
@@ -158,21 +266,41 @@ namespace Math
         }
 
     private:
-        static T mod;
+        static T Remainder(const Wide &x) noexcept
+        {
+            if constexpr (IsStatic())
+            {
+                return x % Mod;
+            }
+            Wide q{static_cast<Wide>((static_cast<__uint128_t>(x) * factor) >> 64)};
+            Wide r{x - q * mod};
+            return r < mod ? r : r - mod;
+        }
+
+    private:
+        static Wide factor;
+        static Wide square;
+        static Wide mod;
 
         T value{};
     };
 
-    template <typename T>
-    std::istream &operator>>(std::istream &stream, ModInt<T> &mi)
+    template <typename T, T Mod>
+    std::istream &operator>>(std::istream &stream, ModInt<T, Mod> &mi)
     {
         T buffer{}; stream >> buffer;
-        mi = ModInt<T>(buffer);
+        mi = ModInt<T, Mod>(buffer);
         return stream;
     }
 
-    template <typename T>
-    T ModInt<T>::mod{};
+    template <typename T, T Mod>
+    typename ModInt<T, Mod>::Wide ModInt<T, Mod>::factor{};
+
+    template <typename T, T Mod>
+    typename ModInt<T, Mod>::Wide ModInt<T, Mod>::square{};
+
+    template <typename T, T Mod>
+    typename ModInt<T, Mod>::Wide ModInt<T, Mod>::mod{};
 
 }; // namespace Math
 
@@ -184,20 +312,23 @@ namespace Solution
 
         constexpr Int D = 2;
 
+        constexpr Int Mod998244353 = 998244353;
+        constexpr Int Mod1000000007 = 1000000007;
+
     };
 
-    using Matrix = Math::SquareMatrix<Math::ModInt<Int>, Constants::D>;
+    template <typename Modular>
+    using Matrix = Math::SquareMatrix<Modular, Constants::D>;
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeEngine<T, Algebra::Product<T>, true>;
 
-    void SolveProblem(std::istream &input, std::ostream &output)
+    template <typename Modular>
+    void Solve(std::istream &input, std::ostream &output, Int n, const Int &m)
     {
-        Int m{}, n{}, r{}; input >> r >> n >> m;
-        Math::ModInt<Int>::SetModulo(r);
-        std::unique_ptr<SegTree<Matrix>> st{};
-        st.reset(new SegTree<Matrix>{0, --n});
-        std::vector<Matrix> initial(++n);
+        std::unique_ptr<SegTree<Matrix<Modular>>> st{};
+        st.reset(new SegTree<Matrix<Modular>>{0, --n});
+        std::vector<Matrix<Modular>> initial(++n);
         for (auto &matrix : initial)
         {
             for (Int i = 0; i < Constants::D; ++i)
@@ -209,11 +340,12 @@ namespace Solution
             }
         }
         st->Build(initial);
+        Matrix<Modular> matrix{};
         for (Int i = 0; i < m; ++i)
         {
             Int l{}; input >> l, --l;
             Int r{}; input >> r, --r;
-            auto &&matrix{st->Query(l, r)};
+            matrix = st->Query(l, r);
             for (Int i = 0; i < Constants::D; ++i)
             {
                 for (Int j = 0; j < Constants::D; ++j)
@@ -224,6 +356,28 @@ namespace Solution
             }
             output << '\n';
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<Matrix<Modular>>::Name << ": " << st->MemoryUsage() << '\n';
+        }
+    }
+
+    void SolveProblem(std::istream &input, std::ostream &output)
+    {
+        Int m{}, n{}, r{}; input >> r >> n >> m;
+        switch (r)
+        {
+        case Constants::Mod998244353:
+            Solve<Math::ModInt<Int, Constants::Mod998244353>>(input, output, n, m);
+            break;
+        case Constants::Mod1000000007:
+            Solve<Math::ModInt<Int, Constants::Mod1000000007>>(input, output, n, m);
+            break;
+        default:
+            Math::ModInt<Int>::SetModulo(r);
+            Solve<Math::ModInt<Int>>(input, output, n, m);
+            break;
+        }
     }
 
     void OptimizeIOStreams()
@@ -1,17 +1,10 @@
-#include <type_traits>
 #include <iostream>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/RangeEngine.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Algebra.hpp"
 
 namespace Util
 {
@@ -27,84 +20,13 @@ namespace Util
 namespace DataStructures
 {
 
-    template <typename T>
-    class SegmentTree
+    class TinySet
     {
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
+        static constexpr bool Commutative{true};
+        static constexpr bool Idempotent{true};
+        static constexpr bool Invertible{false};
 
-        T Query(const Int &l, const Int &r) const noexcept
-        {
-            if (Disjoint(l, r))
-            {
-                return T{};
-            }
-            if (Contained(l, r))
-            {
-                return value;
-            }
-            return left->Query(l, r)
-                + right->Query(l, r);
-        }
-
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-    class TinySet
-    {
     public:
         TinySet(const Int &n) noexcept : set{1LL << n} {}
 
@@ -144,7 +66,7 @@ namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeEngine<T, Algebra::Sum<T>>;
 
     using ValueType = DataStructures::TinySet;
 
@@ -161,6 +83,18 @@ namespace Solution
         return inputStream;
     }
 
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
+    {
+        switch (operation)
+        {
+        case Operation::QueryDifferent:
+            return output << "QueryDifferent";
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        }
+        return output << static_cast<Int>(operation);
+    }
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
         std::unique_ptr<SegTree<ValueType>> st{};
@@ -172,7 +106,8 @@ namespace Solution
             Int v{}; input >> v;
             initial[i] = v;
         }
-        st->Build(initial);
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
         for (Int i = 0; i < m; i++)
         {
             Operation operation{};
@@ -183,19 +118,26 @@ namespace Solution
             {
                 Int index{}; input >> index;
                 Int value{}; input >> value;
-                st->Update(--index, value);
+                profiler.Measure(operation, Profiling::Phase::Update,
+                    [&] { st->Update(--index, value); });
             }
             break;
             case Operation::QueryDifferent:
             {
                 Int l{}; input >> l, --l;
                 Int r{}; input >> r, --r;
-                output << st->Query(l, r);
+                auto different{profiler.Measure(operation, Profiling::Phase::Query,
+                    [&] { return st->Query(l, r); })};
+                output << different;
                 output << '\n';
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<ValueType>::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
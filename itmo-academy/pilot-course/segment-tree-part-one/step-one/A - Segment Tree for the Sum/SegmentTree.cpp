@@ -1,106 +1,15 @@
-#include <type_traits>
 #include <iostream>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
-
-namespace DataStructures
-{
-
-    template <typename T>
-    class SegmentTree
-    {
-        static_assert(std::is_integral<T>::value);
-
-    public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
-
-        T Query(const Int &l, const Int &r) const noexcept
-        {
-            if (Disjoint(l, r))
-            {
-                return T{};
-            }
-            if (Contained(l, r))
-            {
-                return value;
-            }
-            return left->Query(l, r)
-                + right->Query(l, r);
-        }
-
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-}; // namespace DataStructures
+#include "../../library/Aggregate.hpp"
+#include "../../library/Profiling.hpp"
 
 namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeAggregate<T, DataStructures::SumField>;
 
     using ValueType = Long;
 
@@ -117,6 +26,18 @@ namespace Solution
         return input;
     }
 
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
+    {
+        switch (operation)
+        {
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        case Operation::QuerySum:
+            return output << "QuerySum";
+        }
+        return output << static_cast<Int>(operation);
+    }
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
         std::unique_ptr<SegTree<ValueType>> st{};
@@ -127,7 +48,8 @@ namespace Solution
         {
             input >> value;
         }
-        st->Build(initial);
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
         for (Int i = 0; i < m; i++)
         {
             Operation operation{};
@@ -138,19 +60,26 @@ namespace Solution
             {
                 Int index{}; input >> index;
                 ValueType v{}; input >> v;
-                st->Update(index, v);
+                profiler.Measure(operation, Profiling::Phase::Update,
+                    [&] { st->Update(index, v); });
             }
             break;
             case Operation::QuerySum:
             {
                 Int l{}; input >> l;
                 Int r{}; input >> r;
-                output << st->Query(l, --r);
+                auto sum{profiler.Measure(operation, Profiling::Phase::Query,
+                    [&] { return st->Query(l, --r).Sum(); })};
+                output << sum;
                 output << '\n';
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<ValueType>::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
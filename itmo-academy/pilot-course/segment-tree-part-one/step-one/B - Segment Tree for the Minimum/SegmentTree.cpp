@@ -1,103 +1,29 @@
 #include <type_traits>
 #include <iostream>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/RangeMinimumIndex.hpp"
+#include "../../library/RangeEngine.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/SqrtTree.hpp"
+#include "../../library/Algebra.hpp"
 
 namespace DataStructures
 {
 
-    template <typename T>
-    class SegmentTree
-    {
-    public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
-
-        T Query(const Int &l, const Int &r) const noexcept
-        {
-            if (Disjoint(l, r))
-            {
-                return T{};
-            }
-            if (Contained(l, r))
-            {
-                return value;
-            }
-            return left->Query(l, r)
-                + right->Query(l, r);
-        }
-
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
     template <typename T>
     class Minimum
     {
         static_assert(std::is_integral<T>::value);
 
+    public:
+        static constexpr bool Commutative{true};
+        static constexpr bool Idempotent{true};
+        static constexpr bool Invertible{false};
+
     public:
         Minimum(const T &value) noexcept : value{value} {}
 
@@ -125,12 +51,17 @@ namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeEngine<T, Algebra::Sum<T>>;
 
     using Integral = Long;
 
     using ValueType = DataStructures::Minimum<Integral>;
 
+    using StaticTree = DataStructures::RangeMinimumIndex<Integral>;
+
+    template <typename T>
+    using SqrtTree = DataStructures::SqrtTree<T, Algebra::Sum<T>>;
+
     enum class Operation : Int
     {
         ChangeElement = 1,
@@ -144,40 +75,100 @@ namespace Solution
         return input;
     }
 
-    void SolveProblem(std::istream &input, std::ostream &output)
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
-        Int m{}, n{}; input >> n >> m;
-        st.reset(new SegTree<ValueType>{0, --n});
-        std::vector<Integral> initial(++n);
-        for (auto &value : initial)
+        switch (operation)
         {
-            input >> value;
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        case Operation::QuerySum:
+            return output << "QuerySum";
         }
-        st->Build(initial);
-        for (Int i = 0; i < m; i++)
+        return output << static_cast<Int>(operation);
+    }
+
+    struct Command
+    {
+        Operation operation{};
+        Int first{};
+        Integral second{};
+    };
+
+    std::istream &operator>>(std::istream &input, Command &command)
+    {
+        return input >> command.operation >> command.first >> command.second;
+    }
+
+    template <typename Tree>
+    void Process(const std::vector<Integral> &initial,
+        const std::vector<Command> &commands, std::ostream &output)
+    {
+        std::unique_ptr<Tree> st{};
+        st.reset(new Tree{0, static_cast<Int>(initial.size()) - 1});
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
+        for (const auto &command : commands)
         {
-            Operation operation{};
-            input >> operation;
-            switch (operation)
+            switch (command.operation)
             {
             case Operation::ChangeElement:
-            {
-                Int index{}; input >> index;
-                Integral v{}; input >> v;
-                st->Update(index, v);
-            }
-            break;
+                if constexpr (!std::is_same<Tree, StaticTree>::value)
+                {
+                    profiler.Measure(command.operation, Profiling::Phase::Update,
+                        [&] { st->Update(command.first, command.second); });
+                }
+                break;
             case Operation::QuerySum:
             {
-                Int l{}; input >> l;
-                Int r{}; input >> r;
-                output << st->Query(l, --r);
+                Int r(command.second);
+                auto minimum{profiler.Measure(command.operation, Profiling::Phase::Query,
+                    [&] { return st->Query(command.first, --r); })};
+                output << minimum;
                 output << '\n';
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << Tree::Name << ": " << st->MemoryUsage() << '\n';
+        }
+    }
+
+    void SolveProblem(std::istream &input, std::ostream &output)
+    {
+        Int m{}, n{}; input >> n >> m;
+        std::vector<Integral> initial(n);
+        for (auto &value : initial)
+        {
+            input >> value;
+        }
+        Long updates{}, queries{};
+        std::vector<Command> commands(m);
+        for (auto &command : commands)
+        {
+            input >> command;
+            if (command.operation == Operation::ChangeElement)
+            {
+                ++updates;
+            }
+            else
+            {
+                ++queries;
+            }
+        }
+        if (updates == 0)
+        {
+            Process<StaticTree>(initial, commands, output);
+        }
+        else if (updates * std::sqrt(n) < queries * std::log2(n + 1))
+        {
+            Process<SqrtTree<ValueType>>(initial, commands, output);
+        }
+        else
+        {
+            Process<SegTree<ValueType>>(initial, commands, output);
+        }
     }
 
     void OptimizeIOStreams()
@@ -1,148 +1,72 @@
 #include <type_traits>
 #include <iostream>
-#include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/CoordinateCompression.hpp"
+#include "../../library/RangeMinimumIndex.hpp"
+#include "../../library/Aggregate.hpp"
+#include "../../library/Profiling.hpp"
 
 namespace DataStructures
 {
 
     template <typename T>
-    class SegmentTree
+    class RangeMinimumCount
     {
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+        static constexpr const char *Name{"RangeMinimumCount"};
 
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
+    public:
+        RangeMinimumCount(const Int &l, const Int &r) noexcept
+            : leftmost{l, r}, rightmost{l, r}, occurrence(r - l + 1), l{l} {}
 
-        T Query(const Int &l, const Int &r) const noexcept
+        Aggregate<T, MinimumField | CountField> Query(const Int &l, const Int &r) const noexcept
         {
-            if (Disjoint(l, r))
-            {
-                return T{};
-            }
-            if (Contained(l, r))
-            {
-                return value;
-            }
-            return left->Query(l, r)
-                + right->Query(l, r);
+            auto p{leftmost.Index(l, r)}, q{rightmost.Index(l, r)};
+            return {leftmost.At(p), occurrence[q - this->l] - occurrence[p - this->l] + 1};
         }
 
         template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
+        void Build(const Sequence &initial)
         {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
+            leftmost.Build(initial);
+            rightmost.Build(initial);
+            CoordinateCompression compression{};
+            compression.Build(initial);
+            std::vector<Int> seen(compression.Size());
+            for (Int i = 0; i < occurrence.size(); ++i)
             {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
+                occurrence[i] = seen[compression.Rank(i)]++;
             }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
         }
 
-        bool Disjoint(const Int &l, const Int &r) const noexcept
+        MemoryFootprint MemoryUsage() const noexcept
         {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
+            auto usage{leftmost.MemoryUsage()}, mirrored{rightmost.MemoryUsage()};
+            usage.nodeBytes += mirrored.nodeBytes + sizeof(Int);
+            usage.totalBytes += mirrored.totalBytes + AllocatedBytes(occurrence.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
         }
 
     private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
+        RangeMinimumIndex<T> leftmost;
+        RangeMinimumIndex<T, std::less_equal<T>> rightmost;
+        std::vector<Int> occurrence{};
         Int l{};
-        Int r{};
-    };
-
-    template <typename T>
-    class Minimum
-    {
-        static_assert(std::is_integral<T>::value);
-
-    public:
-        Minimum(const T &value, const T &count = T{1}) noexcept : value{value}, count{count} {}
-
-        Minimum() = default;
-
-        template <typename X>
-        friend std::ostream &operator<<(std::ostream &output, const Minimum<X> &minimum);
-
-        Minimum operator+(const Minimum &other) const noexcept
-        {
-            if (value < other.value)
-            {
-                return *this;
-            }
-            if (other.value < value)
-            {
-                return other;
-            }
-            return {value, count + other.count};
-        }
-
-    private:
-        static constexpr T Neutral{std::numeric_limits<T>::max()};
-
-        T value{Neutral};
-        T count{};
     };
-
-    template <typename T>
-    std::ostream &operator<<(std::ostream &output, const Minimum<T> &minimum)
-    {
-        output << minimum.value << ' ' << minimum.count;
-    }
-
 }; // namespace DataStructures
 
 namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeAggregate<T, DataStructures::MinimumField | DataStructures::CountField>;
 
     using Integral = Int;
 
-    using ValueType = DataStructures::Minimum<Integral>;
+    using StaticTree = DataStructures::RangeMinimumCount<Integral>;
 
     enum class Operation : Int
     {
@@ -157,40 +81,89 @@ namespace Solution
         return input;
     }
 
-    void SolveProblem(std::istream &input, std::ostream &output)
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
-        Int m{}, n{}; input >> n >> m;
-        st.reset(new SegTree<ValueType>{0, --n});
-        std::vector<Integral> initial(++n);
-        for (auto &value : initial)
+        switch (operation)
         {
-            input >> value;
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        case Operation::QuerySum:
+            return output << "QuerySum";
         }
-        st->Build(initial);
-        for (Int i = 0; i < m; i++)
+        return output << static_cast<Int>(operation);
+    }
+
+    struct Command
+    {
+        Operation operation{};
+        Int first{};
+        Integral second{};
+    };
+
+    std::istream &operator>>(std::istream &input, Command &command)
+    {
+        return input >> command.operation >> command.first >> command.second;
+    }
+
+    template <typename Tree>
+    void Process(const std::vector<Integral> &initial,
+        const std::vector<Command> &commands, std::ostream &output)
+    {
+        std::unique_ptr<Tree> st{};
+        st.reset(new Tree{0, static_cast<Int>(initial.size()) - 1});
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
+        for (const auto &command : commands)
         {
-            Operation operation{};
-            input >> operation;
-            switch (operation)
+            switch (command.operation)
             {
             case Operation::ChangeElement:
-            {
-                Int index{}; input >> index;
-                Integral v{}; input >> v;
-                st->Update(index, v);
-            }
-            break;
+                if constexpr (!std::is_same<Tree, StaticTree>::value)
+                {
+                    profiler.Measure(command.operation, Profiling::Phase::Update,
+                        [&] { st->Update(command.first, command.second); });
+                }
+                break;
             case Operation::QuerySum:
             {
-                Int l{}; input >> l;
-                Int r{}; input >> r;
-                output << st->Query(l, --r);
+                Int r(command.second);
+                auto minimum{profiler.Measure(command.operation, Profiling::Phase::Query,
+                    [&] { return st->Query(command.first, --r); })};
+                output << minimum;
                 output << '\n';
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << Tree::Name << ": " << st->MemoryUsage() << '\n';
+        }
+    }
+
+    void SolveProblem(std::istream &input, std::ostream &output)
+    {
+        Int m{}, n{}; input >> n >> m;
+        std::vector<Integral> initial(n);
+        for (auto &value : initial)
+        {
+            input >> value;
+        }
+        bool updates{};
+        std::vector<Command> commands(m);
+        for (auto &command : commands)
+        {
+            input >> command;
+            updates |= command.operation == Operation::ChangeElement;
+        }
+        if (updates)
+        {
+            Process<SegTree<Integral>>(initial, commands, output);
+        }
+        else
+        {
+            Process<StaticTree>(initial, commands, output);
+        }
     }
 
     void OptimizeIOStreams()
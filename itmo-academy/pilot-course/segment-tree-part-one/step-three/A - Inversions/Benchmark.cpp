@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "../../library/RangeInversions.hpp"
+#include "../../library/WaveletMatrix.hpp"
+
+namespace Benchmark
+{
+
+    template <typename Engine>
+    void BenchmarkRangeInversions(std::ostream &output, const Int &n, const Int &operations)
+    {
+        using Clock = std::chrono::steady_clock;
+        std::mt19937 random{n};
+        std::vector<Int> initial(n);
+        for (auto &value : initial)
+        {
+            value = random();
+        }
+        Engine engine{0, n - 1};
+        auto start{Clock::now()};
+        engine.Build(initial);
+        auto built{Clock::now()};
+        for (Int k = 0; k < operations; ++k)
+        {
+            engine.Update(random() % n, random());
+        }
+        auto updated{Clock::now()};
+        Long checksum{};
+        for (Int k = 0; k < operations; ++k)
+        {
+            Int a(random() % n), b(random() % n);
+            checksum += engine.Query(std::min(a, b), std::max(a, b));
+        }
+        auto queried{Clock::now()};
+        auto ns{[](const Clock::duration &elapsed)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }};
+        output << Engine::Name << ": n=" << n;
+        output << " build=" << ns(built - start) / 1000000 << " ms";
+        output << " update=" << ns(updated - built) / operations << " ns/op";
+        output << " query=" << ns(queried - updated) / operations << " ns/op";
+        output << " checksum=" << checksum << '\n';
+        output << Engine::Name << ": " << engine.MemoryUsage() << '\n';
+    }
+
+    template <typename Engine>
+    void BenchmarkWaveletMatrix(std::ostream &output, const Int &n, const Int &operations)
+    {
+        using Clock = std::chrono::steady_clock;
+        std::mt19937 random{n};
+        std::vector<Int> initial(n);
+        for (auto &value : initial)
+        {
+            value = random() % n;
+        }
+        Engine engine{0, n - 1};
+        auto start{Clock::now()};
+        engine.Build(initial);
+        auto built{Clock::now()};
+        Long checksum{};
+        Int mismatches{};
+        for (Int k = 0; k < operations; ++k)
+        {
+            Int a(random() % n), b(random() % n);
+            auto l{std::min(a, b)}, r{std::max(a, b)};
+            Int rank(random() % (r - l + 1));
+            auto kth{engine.KthSmallest(l, r, rank)};
+            checksum += kth;
+            mismatches += engine.CountLess(l, r, kth) > rank;
+        }
+        auto selected{Clock::now()};
+        for (Int k = 0; k < operations; ++k)
+        {
+            Int a(random() % n), b(random() % n);
+            checksum += engine.CountLess(std::min(a, b), std::max(a, b), random() % n);
+        }
+        auto counted{Clock::now()};
+        for (Int i = 0; i < std::min(n, 4096u); ++i)
+        {
+            Int less{};
+            for (Int j = 0; j < i; ++j)
+            {
+                less += initial[j] < initial[i];
+            }
+            mismatches += i > 0 && engine.CountLess(0, i - 1, initial[i]) != less;
+        }
+        auto ns{[](const Clock::duration &elapsed)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }};
+        output << Engine::Name << ": n=" << n;
+        output << " build=" << ns(built - start) / 1000000 << " ms";
+        output << " kth=" << ns(selected - built) / operations << " ns/op";
+        output << " count=" << ns(counted - selected) / operations << " ns/op";
+        output << " checksum=" << checksum << " mismatches=" << mismatches << '\n';
+        output << Engine::Name << ": " << engine.MemoryUsage() << '\n';
+    }
+
+}; // namespace Benchmark
+
+int main()
+{
+    Benchmark::BenchmarkRangeInversions<
+        DataStructures::RangeInversions<Int>>(std::cout, 1000000, 1000);
+    Benchmark::BenchmarkWaveletMatrix<
+        DataStructures::WaveletMatrix<Int>>(std::cout, 1000000, 1000000);
+    return 0;
+}
@@ -1,91 +1,188 @@
 #include <type_traits>
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/CoordinateCompression.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Memory.hpp"
 
 namespace DataStructures
 {
 
     template <typename T>
-    class SegmentTree
+    class InversionCounter
     {
-        static_assert(std::is_integral<T>::value);
+    public:
+        static constexpr const char *Name{"InversionCounter"};
 
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+        InversionCounter(const Int &l, const Int &r) noexcept : counts(r - l + 1), l{l} {}
 
-        const T &Update(const Int &i, const T &u) noexcept
+        const Int &Inversions(const Int &i) const noexcept
         {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
+            return counts[i - l];
         }
 
-        T Query(const Int &l, const Int &r) const noexcept
+        const Long &Total() const noexcept
         {
-            if (Disjoint(l, r))
+            return total;
+        }
+
+        template <typename Sequence>
+        void Build(const Sequence &initial)
+        {
+            Int n(counts.size());
+            Int workers{std::thread::hardware_concurrency()};
+            if (n < ParallelThreshold || workers < 2)
             {
-                return T{};
+                CountWithFenwick(Ranks(initial));
+                return;
             }
-            if (Contained(l, r))
+            std::vector<std::pair<T, Int>> items(n);
+            for (Int i = 0; i < n; ++i)
             {
-                return value;
+                items[i] = {initial[i], i};
             }
-            return left->Query(l, r)
-                + right->Query(l, r);
+            buffer.resize(n);
+            Sort(items, 0, n, workers, total);
+            buffer = {};
         }
 
-        const T &Build() noexcept
+        MemoryFootprint MemoryUsage() const noexcept
+        {
+            MemoryFootprint usage{};
+            usage.nodes = counts.size();
+            usage.valueBytes = sizeof(Int);
+            usage.nodeBytes = sizeof(Int);
+            usage.totalBytes = AllocatedBytes(counts.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
+        }
+
+    private:
+        static constexpr Int ParallelThreshold{1 << 16};
+        static constexpr Int InsertionLimit{32};
+
+        template <typename Sequence>
+        bool Dense(const Sequence &initial) const noexcept
         {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
+            if constexpr (std::is_integral<T>::value)
             {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build() + right->Build();
+                Int n(counts.size());
+                for (Int i = 0; i < n; ++i)
+                {
+                    if (n <= static_cast<std::make_unsigned_t<T>>(T(initial[i])))
+                    {
+                        return false;
+                    }
+                }
+                return true;
             }
-            return value;
+            return false;
         }
 
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
+        template <typename Sequence>
+        std::vector<Int> Ranks(const Sequence &initial) const
         {
-            return l <= this->l && this->r <= r;
+            Int n(counts.size());
+            std::vector<Int> rank(n);
+            if (Dense(initial))
+            {
+                for (Int i = 0; i < n; ++i)
+                {
+                    rank[i] = T(initial[i]) + 1;
+                }
+                return rank;
+            }
+            std::vector<std::pair<T, Int>> items(n);
+            for (Int i = 0; i < n; ++i)
+            {
+                items[i] = {initial[i], i};
+            }
+            std::sort(items.begin(), items.end());
+            for (Int k = 0, r = 0; k < n; ++k)
+            {
+                r += k > 0 && items[k - 1].first < items[k].first;
+                rank[items[k].second] = r + 1;
+            }
+            return rank;
         }
 
-        bool Disjoint(const Int &l, const Int &r) const noexcept
+        void CountWithFenwick(const std::vector<Int> &rank) noexcept
         {
-            return r < this->l || this->r < l;
+            std::vector<Int> tree(rank.size() + 1);
+            for (Int i = 0; i < rank.size(); ++i)
+            {
+                Int seen{};
+                for (auto k{rank[i]}; k > 0; k &= k - 1)
+                {
+                    seen += tree[k];
+                }
+                counts[i] = i - seen;
+                total += counts[i];
+                for (auto k{rank[i]}; k < tree.size(); k += k & -k)
+                {
+                    ++tree[k];
+                }
+            }
         }
 
-        bool IsLeaf() const noexcept
+        void Sort(std::vector<std::pair<T, Int>> &items, const Int &lo, const Int &hi,
+            const Int &threads, Long &inversions) noexcept
         {
-            return l == r;
+            if (hi - lo <= InsertionLimit)
+            {
+                for (auto i{lo + 1}; i < hi; ++i)
+                {
+                    auto item{items[i]};
+                    auto j{i};
+                    for (; j > lo && item.first < items[j - 1].first; --j)
+                    {
+                        items[j] = items[j - 1];
+                    }
+                    items[j] = item;
+                    counts[item.second] += i - j;
+                    inversions += i - j;
+                }
+                return;
+            }
+            auto mid{lo + (hi - lo) / 2};
+            Long left{}, right{};
+            if (threads > 1)
+            {
+                std::thread worker{[&] { Sort(items, lo, mid, threads / 2, left); }};
+                Sort(items, mid, hi, threads - threads / 2, right);
+                worker.join();
+            }
+            else
+            {
+                Sort(items, lo, mid, 1, left);
+                Sort(items, mid, hi, 1, right);
+            }
+            inversions += left + right;
+            auto i{lo}, j{mid}, k{lo};
+            while (i < mid || j < hi)
+            {
+                if (j == hi || (i < mid && !(items[j].first < items[i].first)))
+                {
+                    buffer[k++] = items[i++];
+                    continue;
+                }
+                counts[items[j].second] += mid - i;
+                inversions += mid - i;
+                buffer[k++] = items[j++];
+            }
+            std::copy(buffer.begin() + lo, buffer.begin() + hi, items.begin() + lo);
         }
 
     private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
+        std::vector<std::pair<T, Int>> buffer{};
+        std::vector<Int> counts{};
+        Long total{};
         Int l{};
-        Int r{};
     };
 
 }; // namespace DataStructures
@@ -93,25 +190,36 @@ namespace DataStructures
 namespace Solution
 {
 
-    template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
-
     using ValueType = Int;
 
+    using Counter = DataStructures::InversionCounter<ValueType>;
+
+    using Compression = DataStructures::CoordinateCompression;
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
+        std::unique_ptr<Counter> ic{};
         Int n{}; input >> n;
-        st.reset(new SegTree<ValueType>{1, n});
-        st->Build();
-        for (int i = 0; i < n; i++)
+        ic.reset(new Counter{0, n - 1});
+        std::vector<Long> keys(n);
+        for (auto &key : keys)
+        {
+            input >> key;
+        }
+        Compression cc{};
+        cc.Build(keys);
+        ic->Build(cc.Ranks());
+        for (Int i = 0; i < n; i++)
         {
-            ValueType v{}; input >> v;
-            output << st->Query(v, n);
-            st->Update(v, 1);
+            output << ic->Inversions(i);
             output << ' ';
         }
         output << '\n';
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << Counter::Name << ": " << ic->MemoryUsage() << '\n';
+            std::cerr << Compression::Name << ": " << cc.MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
@@ -1,128 +1,42 @@
-#include <type_traits>
 #include <iostream>
 #include <memory>
 #include <vector>
-#include <map>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
-
-namespace DataStructures
-{
-
-    template <typename T>
-    class SegmentTree
-    {
-        static_assert(std::is_integral<T>::value);
-
-    public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
-
-        T Query(const Int &l, const Int &r) const noexcept
-        {
-            if (Disjoint(l, r))
-            {
-                return T{};
-            }
-            if (Contained(l, r))
-            {
-                return value;
-            }
-            return left->Query(l, r)
-                + right->Query(l, r);
-        }
-
-        const T &Build() noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h));
-                right.reset(new SegmentTree(++h, r));
-                value = left->Build() + right->Build();
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-}; // namespace DataStructures
+#include "../../library/CoordinateCompression.hpp"
+#include "../../library/IntervalRelations.hpp"
+#include "../../library/Profiling.hpp"
 
 namespace Solution
 {
 
-    template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using Compression = DataStructures::CoordinateCompression;
 
-    using ValueType = Int;
+    using Relations = DataStructures::IntervalRelations;
 
     void SolveProblem(std::istream &input, std::ostream &output)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
+        std::unique_ptr<Relations> ir{};
         Int m{}, n{}; input >> m, n = 2 * m - 1;
-        st.reset(new SegTree<ValueType>{0, n++});
-        std::vector<ValueType> nested(m);
-        std::map<Int, Int> previous{};
-        st->Build();
-        for (Int i = 0; i < n; i++)
+        ir.reset(new Relations{0, n++});
+        std::vector<Long> keys(n);
+        for (auto &key : keys)
         {
-            Int k{}; input >> k;
-            const auto &&ep{previous.emplace(k, i)};
-            if (!ep.second)
-            {
-                const auto &j{ep.first->second};
-                nested[k - 1] = st->Query(j, i);
-                st->Update(j, 1);
-            }
+            input >> key;
         }
-        for (const auto &count : nested)
+        Compression cc{};
+        cc.Build(keys);
+        ir->Build(cc.Ranks());
+        for (Int k = 0; k < m; k++)
         {
-            output << count << ' ';
+            output << ir->Nested(k);
+            output << ' ';
         }
         output << '\n';
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << Relations::Name << ": " << ir->MemoryUsage() << '\n';
+            std::cerr << Compression::Name << ": " << cc.MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
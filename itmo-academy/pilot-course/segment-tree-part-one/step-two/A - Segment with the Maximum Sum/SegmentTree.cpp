@@ -1,117 +1,206 @@
-#include <type_traits>
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/RangeEngine.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Algebra.hpp"
 
 namespace DataStructures
 {
 
     template <typename T>
-    class SegmentTree
+    class MaximumSegment
     {
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+        static constexpr bool Commutative{false};
+        static constexpr bool Idempotent{false};
+        static constexpr bool Invertible{false};
 
-        const T &Update(const Int &i, const T &u) noexcept
+    public:
+        struct Columns
         {
-            if (Disjoint(i, i))
+            std::vector<T> preffixes{};
+            std::vector<T> suffixes{};
+            std::vector<T> maxima{};
+            std::vector<T> sums{};
+            std::vector<Int> preffixEnds{};
+            std::vector<Int> suffixBegins{};
+            std::vector<Int> begins{};
+            std::vector<Int> ends{};
+
+            void Resize(const Int &size)
             {
-                return value;
+                for (auto column : {&preffixes, &suffixes, &maxima, &sums})
+                {
+                    column->assign(size, T{});
+                }
+                for (auto column : {&preffixEnds, &suffixBegins, &begins, &ends})
+                {
+                    column->assign(size, Int{});
+                }
             }
-            if (Contained(i, i))
+
+            MaximumSegment Load(const Int &i) const noexcept
             {
-                return value = u;
+                MaximumSegment segment{};
+                segment.preffix = preffixes[i];
+                segment.suffix = suffixes[i];
+                segment.max = maxima[i];
+                segment.sum = sums[i];
+                segment.preffixEnd = preffixEnds[i];
+                segment.suffixBegin = suffixBegins[i];
+                segment.begin = begins[i];
+                segment.end = ends[i];
+                segment.empty = false;
+                return segment;
             }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
 
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
+            void Store(const Int &i, const MaximumSegment &segment) noexcept
             {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
+                if (segment.empty)
+                {
+                    preffixes[i] = suffixes[i] = maxima[i] = Absent;
+                    sums[i] = T{};
+                    preffixEnds[i] = suffixBegins[i] = begins[i] = ends[i] = Int{};
+                    return;
+                }
+                preffixes[i] = segment.preffix;
+                suffixes[i] = segment.suffix;
+                maxima[i] = segment.max;
+                sums[i] = segment.sum;
+                preffixEnds[i] = segment.preffixEnd;
+                suffixBegins[i] = segment.suffixBegin;
+                begins[i] = segment.begin;
+                ends[i] = segment.end;
             }
-            else
+
+            void Combine(const Int &a, const Int &b) noexcept
             {
-                value = initial[h];
+                auto preffix{preffixes.data()};
+                auto suffix{suffixes.data()};
+                auto max{maxima.data()};
+                auto sum{sums.data()};
+                auto preffixEnd{preffixEnds.data()};
+                auto suffixBegin{suffixBegins.data()};
+                auto begin{begins.data()};
+                auto end{ends.data()};
+#pragma GCC ivdep
+                for (auto p{a}; p < b; ++p)
+                {
+                    auto x{2 * p}, y{2 * p + 1};
+                    auto extended{sum[x] + preffix[y]};
+                    auto left{preffix[x] < extended};
+                    preffixEnd[p] = !left * preffixEnd[x] + left * preffixEnd[y];
+                    preffix[p] = std::max(preffix[x], extended);
+                    auto widened{sum[y] + suffix[x]};
+                    auto right{suffix[y] < widened};
+                    suffixBegin[p] = !right * suffixBegin[y] + right * suffixBegin[x];
+                    suffix[p] = std::max(suffix[y], widened);
+                    sum[p] = sum[x] + sum[y];
+                    auto bridge{suffix[x] + preffix[y]};
+                    auto inner{max[x] < max[y]};
+                    auto best{std::max(max[x], max[y])};
+                    auto crossing{best < bridge};
+                    auto keep{!inner && !crossing}, other{inner && !crossing};
+                    begin[p] = keep * begin[x] + other * begin[y] + crossing * suffixBegin[x];
+                    end[p] = keep * end[x] + other * end[y] + crossing * preffixEnd[y];
+                    max[p] = std::max(best, bridge);
+                }
             }
-            return value;
-        }
 
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
+            Long Bytes() const noexcept
+            {
+                Long bytes{};
+                for (auto column : {&preffixes, &suffixes, &maxima, &sums})
+                {
+                    bytes += AllocatedBytes(column->capacity() * sizeof(T));
+                }
+                for (auto column : {&preffixEnds, &suffixBegins, &begins, &ends})
+                {
+                    bytes += AllocatedBytes(column->capacity() * sizeof(Int));
+                }
+                return bytes;
+            }
 
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
+        private:
+            static constexpr T Absent{std::numeric_limits<T>::lowest() / 4};
+        };
 
-    template <typename T>
-    class MaximumSegment
-    {
     public:
-        MaximumSegment(const T &v) noexcept : max{std::max(v, T{})}, preffix{v}, suffix{v}, sum{v} {}
+        MaximumSegment(const T &v, const Int &i) noexcept
+            : preffix{v}, suffix{v}, max{std::max(v, T{})}, sum{v}, preffixEnd{i + 1},
+              suffixBegin{i}, begin{i}, end{v > 0 ? i + 1 : i}, empty{false} {}
 
         MaximumSegment() = default;
 
         MaximumSegment operator+(const MaximumSegment &other) const noexcept
         {
-            MaximumSegment result{};
-            auto &m{result.max};
-            result.suffix = std::max(other.suffix, other.sum + suffix);
-            result.preffix = std::max(preffix, sum + other.preffix);
-            m = std::max(m, suffix + other.preffix);
-            m = std::max(m, result.preffix);
-            m = std::max(m, result.suffix);
+            if (empty)
+            {
+                return other;
+            }
+            if (other.empty)
+            {
+                return *this;
+            }
+            MaximumSegment result{*this};
             result.sum = sum + other.sum;
-            m = std::max(m, other.max);
-            m = std::max(m, max);
+            if (result.preffix < sum + other.preffix)
+            {
+                result.preffix = sum + other.preffix;
+                result.preffixEnd = other.preffixEnd;
+            }
+            result.suffix = other.suffix;
+            result.suffixBegin = other.suffixBegin;
+            if (result.suffix < other.sum + suffix)
+            {
+                result.suffix = other.sum + suffix;
+                result.suffixBegin = suffixBegin;
+            }
+            result.Consider(other.max, other.begin, other.end);
+            result.Consider(suffix + other.preffix, suffixBegin, other.preffixEnd);
             return result;
         }
 
+        const Int &Begin() const noexcept
+        {
+            return begin;
+        }
+
+        const Int &End() const noexcept
+        {
+            return end;
+        }
+
         operator const T &() const noexcept
         {
             return max;
         }
 
+    private:
+        void Consider(const T &candidate, const Int &begin, const Int &end) noexcept
+        {
+            if (max < candidate)
+            {
+                max = candidate;
+                this->begin = begin;
+                this->end = end;
+            }
+        }
+
     private:
         T preffix{};
         T suffix{};
         T max{};
         T sum{};
+        Int preffixEnd{};
+        Int suffixBegin{};
+        Int begin{};
+        Int end{};
+        bool empty{true};
     };
 
 }; // namespace DataStructures
@@ -120,7 +209,7 @@ namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeEngine<T, Algebra::Sum<T>>;
 
     using Integral = Long;
 
@@ -131,19 +220,26 @@ namespace Solution
         std::unique_ptr<SegTree<ValueType>> st{};
         Int m{}, n{}; input >> n >> m;
         st.reset(new SegTree<ValueType>{0, --n});
-        std::vector<Integral> initial(++n);
-        for (auto &value : initial)
+        std::vector<ValueType> initial(++n);
+        for (Int i = 0; i < n; ++i)
         {
-            input >> value;
+            Integral value{}; input >> value;
+            initial[i] = {value, i};
         }
-        std::cout << st->Build(initial) << '\n';
+        st->Build(initial);
+        std::cout << static_cast<const Integral &>(st->Root()) << '\n';
         for (Int i = 0; i < m; i++)
         {
             Int index{}; input >> index;
             Integral v{}; input >> v;
-            std::cout << st->Update(index, v);
+            st->Update(index, {v, index});
+            std::cout << static_cast<const Integral &>(st->Root());
             std::cout << '\n';
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<ValueType>::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
@@ -1,97 +1,118 @@
-#include <type_traits>
 #include <iostream>
-#include <limits>
 #include <memory>
 #include <vector>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
+#include "../../library/Profiling.hpp"
+#include "../../library/Memory.hpp"
 
 namespace DataStructures
 {
 
-    template <typename T>
-    class SegmentTree
+    class BitVector
     {
-        static_assert(std::is_integral<T>::value);
+    public:
+        static constexpr const char *Name{"BitVector"};
 
     public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
+        BitVector(const Int &l, const Int &r) noexcept
+            : words((r - l + Width) / Width), counts(words.size() + 1), l{l}
+        {
+            for (high = 1; 2 * high <= words.size(); high <<= 1);
+        }
 
-        Int KthOne(const T &k) const noexcept
+        Int KthOne(Int k) const noexcept
         {
-            if (!this->IsLeaf())
+            Int w{};
+            for (auto step{high}; step > 0; step >>= 1)
             {
-                if (left->value <= k)
+                if (w + step <= words.size() && counts[w + step] <= k)
                 {
-                    return right->KthOne(k - left->value);
+                    w += step;
+                    k -= counts[w];
                 }
-                return left->KthOne(k);
             }
-            return l;
+            return l + w * Width + Select(words[w], k);
         }
 
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
+        Int Rank(const Int &i) const noexcept
         {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
+            auto p{i - l};
+            Int rank{};
+            for (auto w{p / Width}; w > 0; w &= w - 1)
             {
-                value = initial[h];
+                rank += counts[w];
             }
-            return value;
+            auto mask{(1ULL << (p % Width)) - 1};
+            return rank + __builtin_popcountll(words[p / Width] & mask);
         }
 
-        const T &Flip(const Int &i) noexcept
+        template <typename Sequence>
+        void Build(const Sequence &initial) noexcept
         {
-            if (Disjoint(i, i))
+            for (Int i = 0; i < initial.size(); ++i)
             {
-                return value;
+                words[i / Width] |= static_cast<unsigned long long>(initial[i] != 0) << (i % Width);
             }
-            if (Contained(i, i))
+            for (Int w = 1; w < counts.size(); ++w)
             {
-                return value = !value;
+                counts[w] += __builtin_popcountll(words[w - 1]);
+                auto parent{w + (w & -w)};
+                if (parent < counts.size())
+                {
+                    counts[parent] += counts[w];
+                }
             }
-            return value = left->Flip(i)
-                        + right->Flip(i);
         }
 
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
+        void Flip(const Int &i) noexcept
         {
-            return l <= this->l && this->r <= r;
+            auto p{i - l};
+            auto bit{1ULL << (p % Width)};
+            auto &word{words[p / Width]};
+            word ^= bit;
+            auto delta{word & bit ? 1u : -1u};
+            for (auto w{p / Width + 1}; w < counts.size(); w += w & -w)
+            {
+                counts[w] += delta;
+            }
         }
 
-        bool Disjoint(const Int &l, const Int &r) const noexcept
+        MemoryFootprint MemoryUsage() const noexcept
         {
-            return r < this->l || this->r < l;
+            MemoryFootprint usage{};
+            usage.nodes = words.size();
+            usage.valueBytes = sizeof(unsigned long long);
+            usage.nodeBytes = sizeof(unsigned long long) + sizeof(Int);
+            usage.totalBytes = AllocatedBytes(words.capacity() * sizeof(unsigned long long))
+                + AllocatedBytes(counts.capacity() * sizeof(Int));
+            usage.slackBytes = usage.totalBytes - usage.nodes * usage.nodeBytes;
+            return usage;
         }
 
-        bool IsLeaf() const noexcept
+    private:
+        static constexpr Int Width{64};
+
+        static Int Select(unsigned long long word, Int k) noexcept
         {
-            return l == r;
+#ifdef __BMI2__
+            return __builtin_ctzll(_pdep_u64(1ULL << k, word));
+#else
+            for (; k > 0; --k)
+            {
+                word &= word - 1;
+            }
+            return __builtin_ctzll(word);
+#endif
         }
 
     private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
+        std::vector<unsigned long long> words{};
+        std::vector<Int> counts{};
+        Int high{};
         Int l{};
-        Int r{};
     };
 
 }; // namespace DataStructures
@@ -99,8 +120,7 @@ namespace DataStructures
 namespace Solution
 {
 
-    template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using BitTree = DataStructures::BitVector;
 
     using Integral = Int;
 
@@ -119,17 +139,30 @@ namespace Solution
         return inputStream;
     }
 
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
+    {
+        switch (operation)
+        {
+        case Operation::FlipPosition:
+            return output << "FlipPosition";
+        case Operation::FindKthOne:
+            return output << "FindKthOne";
+        }
+        return output << static_cast<Int>(operation);
+    }
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
+        std::unique_ptr<BitTree> st{};
         Int m{}, n{}; input >> n >> m;
-        st.reset(new SegTree<ValueType>{0, --n});
+        st.reset(new BitTree{0, --n});
         std::vector<Integral> initial(++n);
         for (auto &value : initial)
         {
             input >> value;
         }
-        st->Build(initial);
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
         for (Int i = 0; i < m; i++)
         {
             Operation operation;
@@ -139,18 +172,24 @@ namespace Solution
             case Operation::FlipPosition:
             {
                 Int index{}; input >> index;
-                st->Flip(index);
+                profiler.Measure(operation, Profiling::Phase::Update, [&] { st->Flip(index); });
             }
             break;
             case Operation::FindKthOne:
             {
                 ValueType k{}; input >> k;
-                std::cout << st->KthOne(k);
+                auto index{profiler.Measure(operation, Profiling::Phase::Query,
+                    [&] { return st->KthOne(k); })};
+                std::cout << index;
                 std::cout << '\n';
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << BitTree::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
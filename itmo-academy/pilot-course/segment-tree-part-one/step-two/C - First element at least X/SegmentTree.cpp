@@ -1,138 +1,24 @@
-#include <type_traits>
 #include <iostream>
-#include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
+#include "../../library/SegmentTree.hpp"
+#include "../../library/Aggregate.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Algebra.hpp"
 
-using namespace Types;
-
-namespace DataStructures
+namespace Solution
 {
 
     template <typename T>
-    class SegmentTree
-    {
-    public:
-        static constexpr Int NPos{std::numeric_limits<Int>::max()};
-
-    public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
-
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-        Int FirstAtLeast(const T &x) const noexcept
-        {
-            if (!this->IsLeaf())
-            {
-                if (left->value < x)
-                {
-                    return right->FirstAtLeast(x);
-                }
-                return left->FirstAtLeast(x);
-            }
-            return value < x ? NPos : l;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-    template <typename T>
-    class Maximum
-    {
-        static_assert(std::is_integral<T>::value);
-
-    public:
-        Maximum(const T &value) noexcept : value{value} {}
-
-        Maximum() = default;
-
-        Maximum operator+(const Maximum &other) const noexcept
-        {
-            return {std::max(value, other.value)};
-        }
-
-        operator const T &() const noexcept
-        {
-            return value;
-        }
-
-    private:
-        static constexpr T Neutral{std::numeric_limits<T>::min()};
-
-        T value{Neutral};
-    };
-
-}; // namespace DataStructures
-
-namespace Solution
-{
+    using ValueType = DataStructures::Aggregate<T, DataStructures::MaximumField>;
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::RangeAggregate<T, DataStructures::MaximumField,
+        DataStructures::SegmentTree<ValueType<T>, Algebra::Sum<ValueType<T>>>>;
 
     using Integral = Int;
 
-    using ValueType = DataStructures::Maximum<Integral>;
-
     enum class Operation : Int
     {
         ChangeElement = 1,
@@ -146,17 +32,30 @@ namespace Solution
         return inputStream;
     }
 
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
+    {
+        switch (operation)
+        {
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        case Operation::FindGreaterOrEqual:
+            return output << "FindGreaterOrEqual";
+        }
+        return output << static_cast<Int>(operation);
+    }
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
-        std::unique_ptr<SegTree<ValueType>> st{};
+        std::unique_ptr<SegTree<Integral>> st{};
         Int m{}, n{}; input >> n >> m;
-        st.reset(new SegTree<ValueType>{0, --n});
+        st.reset(new SegTree<Integral>{0, --n});
         std::vector<Integral> initial(++n);
         for (auto &value : initial)
         {
             input >> value;
         }
-        st->Build(initial);
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
         for (Int i = 0; i < m; i++)
         {
             Operation operation{};
@@ -166,7 +65,8 @@ namespace Solution
             case Operation::FindGreaterOrEqual:
             {
                 Integral v{}; input >> v;
-                Int index{st->FirstAtLeast(v)};
+                Int index{profiler.Measure(operation, Profiling::Phase::Query,
+                    [&] { return st->FirstAtLeast(v); })};
                 if (index != st->NPos)
                 {
                     output << index;
@@ -182,11 +82,16 @@ namespace Solution
             {
                 Int index{}; input >> index;
                 Integral v{}; input >> v;
-                st->Update(index, v);
+                profiler.Measure(operation, Profiling::Phase::Update,
+                    [&] { st->Update(index, v); });
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<Integral>::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()
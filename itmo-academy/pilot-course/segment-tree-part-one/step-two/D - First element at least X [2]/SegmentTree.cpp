@@ -1,148 +1,17 @@
-#include <type_traits>
 #include <iostream>
-#include <limits>
 #include <memory>
 #include <vector>
 
-namespace Types
-{
-
-    using Long = long long int;
-    using Int = unsigned int;
-
-}; // namespace Types
-
-using namespace Types;
-
-namespace DataStructures
-{
-
-    template <typename T>
-    class SegmentTree
-    {
-    public:
-        static constexpr Int NPos{std::numeric_limits<Int>::max()};
-
-    public:
-        SegmentTree(const Int &l, const Int &r) noexcept : l{l}, r{r} {}
-
-        Int FirstAtLeast(const Int &i, const T &x) const noexcept
-        {
-            if (IsBefore(i) || value < x)
-            {
-                return SegmentTree::NPos;
-            }
-            if (!this->IsLeaf())
-            {
-                auto index{left->FirstAtLeast(i, x)};
-                if (index == SegmentTree::NPos)
-                {
-                    return right->FirstAtLeast(i, x);
-                }
-                return index;
-            }
-            return l;
-        }
-
-        const T &Update(const Int &i, const T &u) noexcept
-        {
-            if (Disjoint(i, i))
-            {
-                return value;
-            }
-            if (Contained(i, i))
-            {
-                return value = u;
-            }
-            return value = left->Update(i, u)
-                        + right->Update(i, u);
-        }
-
-        template <typename Sequence>
-        const T &Build(const Sequence &initial) noexcept
-        {
-            auto h{(l + r) / 2};
-            if (!this->IsLeaf())
-            {
-                left.reset(new SegmentTree(l, h++));
-                right.reset(new SegmentTree(h, r));
-                value = left->Build(initial)
-                    + right->Build(initial);
-            }
-            else
-            {
-                value = initial[h];
-            }
-            return value;
-        }
-
-    private:
-        bool Contained(const Int &l, const Int &r) const noexcept
-        {
-            return l <= this->l && this->r <= r;
-        }
-
-        bool Disjoint(const Int &l, const Int &r) const noexcept
-        {
-            return r < this->l || this->r < l;
-        }
-
-        bool Contains(const Int &i) const noexcept
-        {
-            return this->l <= i && i <= this->r;
-        }
-
-        bool IsBefore(const Int &i) const noexcept
-        {
-            return !(Contains(i) || i < l);
-        }
-
-        bool IsLeaf() const noexcept
-        {
-            return l == r;
-        }
-
-    private:
-        std::unique_ptr<SegmentTree> right{};
-        std::unique_ptr<SegmentTree> left{};
-        T value{};
-        Int l{};
-        Int r{};
-    };
-
-    template <typename T>
-    class Maximum
-    {
-        static_assert(std::is_integral<T>::value);
-
-    public:
-        Maximum(const T &value) noexcept : value{value} {}
-
-        Maximum() = default;
-
-        Maximum operator+(const Maximum &other) const noexcept
-        {
-            return {std::max(value, other.value)};
-        }
-
-        operator const T &() const noexcept
-        {
-            return value;
-        }
-
-    private:
-        static constexpr T Neutral{std::numeric_limits<T>::min()};
-
-        T value{Neutral};
-    };
-
-}; // namespace DataStructures
+#include "../../library/SegmentTree.hpp"
+#include "../../library/Profiling.hpp"
+#include "../../library/Algebra.hpp"
+#include "../../library/Maximum.hpp"
 
 namespace Solution
 {
 
     template <typename T>
-    using SegTree = DataStructures::SegmentTree<T>;
+    using SegTree = DataStructures::SegmentTree<T, Algebra::Sum<T>>;
 
     using Integral = Int;
 
@@ -161,6 +30,18 @@ namespace Solution
         return inputStream;
     }
 
+    std::ostream &operator<<(std::ostream &output, const Operation &operation)
+    {
+        switch (operation)
+        {
+        case Operation::ChangeElement:
+            return output << "ChangeElement";
+        case Operation::FindGreaterOrEqual:
+            return output << "FindGreaterOrEqual";
+        }
+        return output << static_cast<Int>(operation);
+    }
+
     void SolveProblem(std::istream &input, std::ostream &output)
     {
         std::unique_ptr<SegTree<ValueType>> st{};
@@ -171,7 +52,8 @@ namespace Solution
         {
             input >> value;
         }
-        st->Build(initial);
+        Profiling::Profiler<Operation> profiler{};
+        profiler.Measure(Profiling::Phase::Build, [&] { st->Build(initial); });
         for (Int i = 0; i < m; i++)
         {
             Operation operation{};
@@ -182,24 +64,32 @@ namespace Solution
             {
                 Integral v{}; input >> v;
                 Int l{}; input >> l;
-                auto index{st->FirstAtLeast(l, v)};
+                auto index{profiler.Measure(operation, Profiling::Phase::Query,
+                    [&] { return st->FirstAtLeast(l, v); })};
                 if (index != st->NPos)
                 {
                     output << index << '\n';
-                    continue;
                 }
-                output << "-1\n";
+                else
+                {
+                    output << "-1\n";
+                }
             }
             break;
             case Operation::ChangeElement:
             {
                 Int index{}; input >> index;
                 Integral v{}; input >> v;
-                st->Update(index, v);
+                profiler.Measure(operation, Profiling::Phase::Update,
+                    [&] { st->Update(index, v); });
             }
             break;
             }
         }
+        if constexpr (Profiling::MemoryEnabled)
+        {
+            std::cerr << SegTree<ValueType>::Name << ": " << st->MemoryUsage() << '\n';
+        }
     }
 
     void OptimizeIOStreams()